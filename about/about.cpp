@@ -3,7 +3,7 @@
 GolfScoreAbout::GolfScoreAbout(ViewDispatcher **viewDispatcher) : widget(nullptr), viewDispatcherRef(viewDispatcher)
 {
     easy_flipper_set_widget(&widget, GolfScoreViewAbout,
-                            "Track golf rounds for up to 4 players.\n"
+                            "Track golf rounds for up to 32 players.\n"
                             "Use Round Setup to adjust players and reset scores.\n\n"
                             "Template adapted for score keeping.",
                             callbackToSubmenu, viewDispatcherRef);
@@ -3,8 +3,16 @@
 #include "about/about.hpp"
 #include "scorecard/scorecard.hpp"
 #include "settings/settings.hpp"
+#include "summary/summary.hpp"
+#include "history/history.hpp"
+#include "round/round_kernels.hpp"
+#include "debug/memory_probe.hpp"
+#include "debug/trace.hpp"
+#include "debug/perf_counters.hpp"
+#include "debug/latency.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdio>
 #include <cstring>
 
@@ -15,11 +23,26 @@
 
 namespace
 {
-    constexpr uint8_t StateVersion = 2;
+    constexpr uint8_t StateVersion = 9;
     constexpr const char *StateFileName = "state.bin";
+    constexpr const char *JournalFileName = "state.journal";
+    constexpr uint32_t JournalMagic = 0x324A5347;   // "GSJ2"
+    constexpr uint32_t JournalMagicV1 = 0x314A5347; // "GSJ1": new entry only, no undo history
+    constexpr uint16_t JournalCompactEntries = 256; // Fold into state.bin past this many edits
+    // No journal the app writes is longer than the carried-over undo ring
+    // plus a full run of edits; replay reads no further
+    constexpr uint32_t JournalReplayLimit = JournalCompactEntries + GolfScoreUndoDepth * 2;
     constexpr const char *HistoryFileName = "rounds.csv";
     constexpr uint32_t SplashEventId = 0xA55AA001;
     constexpr uint32_t RoundSummaryEventId = 0xA55AA002;
+    constexpr uint32_t StateLoadEventId = 0xA55AA003;
+
+    // Versions 1 and 2 stored a fixed four-player, player-major block;
+    // versions 2 and 3 kept five course presets inline; versions 1 to 4
+    // always stored 18 holes
+    constexpr size_t LegacyMaxPlayers = 4;
+    constexpr size_t LegacyMaxHoles = 18;
+    constexpr size_t LegacyMaxCourses = 5;
 
     struct PersistentStateV1
     {
@@ -27,11 +50,273 @@ namespace
         uint8_t playerCount = 1;
         uint8_t holeCount = 9;
         uint8_t reserved = 0;
-        std::array<std::array<char, GolfScoreApp::MaxNameLength>, GolfScoreApp::MaxPlayers> playerNames{};
-        std::array<std::array<uint8_t, GolfScoreApp::MaxHoles>, GolfScoreApp::MaxPlayers> strokes{};
-        std::array<uint8_t, GolfScoreApp::MaxHoles> par{};
+        std::array<std::array<char, GolfScoreMaxNameLength>, LegacyMaxPlayers> playerNames{};
+        std::array<std::array<uint8_t, LegacyMaxHoles>, LegacyMaxPlayers> strokes{};
+        std::array<uint8_t, LegacyMaxHoles> par{};
+    };
+
+    struct CoursePresetV2
+    {
+        uint8_t holeCount = 0;
+        std::array<uint8_t, LegacyMaxHoles> par{};
+        std::array<char, GolfScoreCourseNameLength> name{};
+    };
+
+    struct PersistentStateV2
+    {
+        PersistentStateV1 base{};
+        std::array<CoursePresetV2, LegacyMaxCourses> courses{};
+        uint8_t activeCourse = 0xFF;
+    };
+
+    struct PersistentStateV3
+    {
+        uint8_t version = 0;
+        uint8_t playerCount = 1;
+        uint8_t holeCount = 9;
+        uint8_t reserved = 0;
+        std::array<uint8_t, LegacyMaxHoles> par{};
+        std::array<CoursePresetV2, LegacyMaxCourses> courses{};
+        uint8_t activeCourse = 0xFF;
+    };
+
+    struct PersistentStateV4
+    {
+        uint8_t version = 0;
+        uint8_t playerCount = 1;
+        uint8_t holeCount = 9;
+        uint8_t reserved = 0;
+        std::array<uint8_t, LegacyMaxHoles> par{};
+        uint16_t activeCourse = 0xFFFF;
+        std::array<char, GolfScoreCourseNameLength> activeCourseName{};
+    };
+
+    // Versions 5 and 6 had no scoring format in the header
+    struct PersistentStateV6
+    {
+        uint8_t version = 0;
+        uint8_t playerCount = 1;
+        uint8_t holeCount = 9;
+        uint8_t generation = 0;
+        uint16_t activeCourse = 0xFFFF;
+        std::array<char, GolfScoreCourseNameLength> activeCourseName{};
+    };
+
+    // Older releases wrote these byte for byte; host_format_test loads their files
+    static_assert(sizeof(PersistentStateV1) == 158, "v1 state layout changed");
+    static_assert(sizeof(PersistentStateV2) == 334, "v2 state layout changed");
+    static_assert(sizeof(PersistentStateV3) == 198, "v3 state layout changed");
+    static_assert(sizeof(PersistentStateV4) == 40 && offsetof(PersistentStateV4, activeCourse) == 22, "v4 state layout changed");
+    static_assert(sizeof(PersistentStateV6) == 22 && offsetof(PersistentStateV6, activeCourse) == 4, "v6 state layout changed");
+
+    constexpr uint8_t StandardHoleCounts[] = {9, 18, 27, 36};
+
+    enum JournalKind : uint8_t
+    {
+        JournalEdit = 0,
+        JournalUndo = 1,
+        JournalRedo = 2,
+        JournalHistory = 3,
     };
 
+    // state.journal: a header naming the snapshot generation, then one
+    // record per hole edit, undo or redo carrying the edit's before and
+    // after entries, so replay rebuilds the undo ring along with the card.
+    // A fresh journal starts with the ring carried over from before the
+    // snapshot: History records (pushed, not applied) then one Undo per op
+    // on the redo side, whose before entries the snapshot already holds.
+    // Those carry JournalCarried, so replaying them alone is no reason to
+    // write a new snapshot.
+    struct JournalHeader
+    {
+        uint32_t magic = JournalMagic;
+        uint8_t generation = 0;
+        uint8_t reserved[3] = {};
+    };
+
+    constexpr uint8_t JournalCarried = 0x01;
+
+    struct JournalRecord
+    {
+        uint8_t kind = JournalEdit; // JournalKind
+        uint8_t flags = 0;          // JournalCarried; older releases wrote 0
+        GolfScoreEditOp op;
+    };
+    static_assert(sizeof(JournalRecord) == 8, "journal record layout changed");
+
+    struct JournalRecordV1
+    {
+        uint8_t player;
+        uint8_t hole;
+        GolfScoreHoleEntry entry;
+    };
+    static_assert(sizeof(JournalRecordV1) == 4, "v1 journal record layout changed");
+
+    // Versions before 6 stored one stroke byte per player and hole
+    bool read_stroke_bytes(File *file, GolfScoreRound &players)
+    {
+        size_t count = static_cast<size_t>(players.holeCount()) * players.playerCount();
+        auto bytes = std::make_unique<uint8_t[]>(count);
+        if (!bytes || storage_file_read(file, bytes.get(), count) != count)
+        {
+            return false;
+        }
+
+        GolfScoreHoleEntry *entries = players.entryData();
+        for (size_t i = 0; i < count; ++i)
+        {
+            entries[i] = GolfScoreHoleEntry{};
+            entries[i].strokes = std::min(bytes[i], GolfScoreMaxStrokes);
+        }
+        return true;
+    }
+}
+
+struct GolfScoreApp::LegacyCourses
+{
+    std::array<CoursePresetV2, LegacyMaxCourses> courses{};
+    uint8_t active = 0xFF;
+    bool present = false;
+};
+
+namespace
+{
+    // CSV Relative field: "--" before any hole is played, "+N", "0" or "-N"
+    void format_relation(bool played, int relative, char *output, size_t size)
+    {
+        if (!played)
+        {
+            snprintf(output, size, "--");
+        }
+        else if (relative > 0)
+        {
+            snprintf(output, size, "+%d", relative);
+        }
+        else
+        {
+            snprintf(output, size, "%d", relative);
+        }
+    }
+
+    constexpr char HistoryResultColumns[] = "Date,Time,Course,HoleCount,Player,Total,Relative";
+
+    // Every row carries one stroke field per header column, H1..H<MaxHoles>,
+    // empty past the round's last hole
+    void round_history_header(FuriString *header)
+    {
+        furi_string_set_str(header, HistoryResultColumns);
+        for (uint8_t hole = 0; hole < GolfScoreMaxHoles; ++hole)
+        {
+            furi_string_cat_printf(header, ",H%u", static_cast<unsigned>(hole + 1));
+        }
+        furi_string_cat_str(header, "\r\n");
+    }
+
+    // Logs started before rounds could have 36 holes name only H1..H18. They
+    // are copied once under the current header with every row padded to it.
+    bool widen_round_history(Storage *storage, const char *path, FuriString *header)
+    {
+        File *in = storage_file_alloc(storage);
+        if (!in)
+        {
+            return false;
+        }
+
+        char buffer[256];
+        size_t count = 0;
+        if (storage_file_open(in, path, FSAM_READ, FSOM_OPEN_EXISTING))
+        {
+            count = storage_file_read(in, buffer, sizeof(buffer) - 1);
+        }
+        buffer[count] = '\0';
+
+        // Nothing to do for a new or empty log, one already this wide, or a
+        // file the app did not write
+        const char *headerEnd = strchr(buffer, '\n');
+        size_t prefix = sizeof(HistoryResultColumns) - 1;
+        size_t columns = headerEnd ? static_cast<size_t>(std::count(static_cast<const char *>(buffer) + prefix, headerEnd, ',')) : 0;
+        if (!headerEnd || strncmp(buffer, HistoryResultColumns, prefix) != 0 || columns >= GolfScoreMaxHoles)
+        {
+            storage_file_free(in);
+            return true;
+        }
+
+        char widePath[264];
+        snprintf(widePath, sizeof(widePath), "%s.tmp", path);
+        File *out = storage_file_alloc(storage);
+        bool ok = out && storage_file_open(out, widePath, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                  golf_score_file_write(out, furi_string_get_cstr(header), furi_string_size(header)) == furi_string_size(header) &&
+                  storage_file_seek(in, static_cast<uint32_t>(headerEnd - buffer + 1), true);
+
+        char pending[256];
+        size_t pendingLength = 0;
+        auto put = [&](char ch)
+        {
+            if (pendingLength == sizeof(pending))
+            {
+                ok = ok && golf_score_file_write(out, pending, pendingLength) == pendingLength;
+                pendingLength = 0;
+            }
+            pending[pendingLength++] = ch;
+        };
+
+        // Pads before each row's line break, keeping "\r\n" together
+        size_t lineLength = 0;
+        bool carriageReturn = false;
+        auto endLine = [&]()
+        {
+            for (size_t i = 0; lineLength > 0 && i < GolfScoreMaxHoles - columns; ++i)
+            {
+                put(',');
+            }
+            if (carriageReturn)
+            {
+                put('\r');
+            }
+            lineLength = 0;
+            carriageReturn = false;
+        };
+
+        while (ok && (count = storage_file_read(in, buffer, sizeof(buffer))) > 0)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                char ch = buffer[i];
+                if (ch == '\n')
+                {
+                    endLine();
+                    put('\n');
+                    continue;
+                }
+                if (carriageReturn)
+                {
+                    put('\r');
+                    ++lineLength;
+                }
+                carriageReturn = ch == '\r';
+                if (!carriageReturn)
+                {
+                    put(ch);
+                    ++lineLength;
+                }
+            }
+        }
+        endLine();
+        ok = ok && golf_score_file_write(out, pending, pendingLength) == pendingLength;
+
+        storage_file_free(in);
+        if (out)
+        {
+            storage_file_free(out);
+        }
+        ok = ok && storage_common_remove(storage, path) == FSE_OK && storage_common_rename(storage, widePath, path) == FSE_OK;
+        if (!ok)
+        {
+            storage_common_remove(storage, widePath);
+        }
+        return ok;
+    }
+
     void sanitize_csv_field(const char *input, char *output, size_t size)
     {
         if (!output || size == 0)
@@ -62,6 +347,8 @@ namespace
 
 GolfScoreApp::GolfScoreApp()
 {
+    constructedTick = furi_get_tick();
+
     gui = static_cast<Gui *>(furi_record_open(RECORD_GUI));
 
     if (!easy_flipper_set_view_dispatcher(&viewDispatcher, gui, this))
@@ -84,31 +371,46 @@ GolfScoreApp::GolfScoreApp()
     submenu_add_item(submenu, "About", GolfScoreMenuAbout, submenuChoicesCallback, this);
 
     createAppDataPath();
+    golf_score_latency_load();
     applyDefaults();
-    loadState();
 
-    if (!easy_flipper_set_view(&splashView, GolfScoreViewSplash, splashDraw, nullptr, nullptr, &viewDispatcher, this))
+    splashBitmap = std::make_unique<uint8_t[]>(SPLASH_SCREEN_BITMAP_SIZE);
+    if (splashBitmap && !splash_screen_decode(splashBitmap.get(), SPLASH_SCREEN_BITMAP_SIZE))
     {
-        splashView = nullptr;
+        splashBitmap.reset();
     }
 
-    splashTimer = furi_timer_alloc(splashTimerCallback, FuriTimerTypeOnce, this);
-    if (splashTimer)
+    if (!easy_flipper_set_view(&splashView, GolfScoreViewSplash, splashDraw, splashInput, nullptr, &viewDispatcher, this))
     {
-        furi_timer_start(splashTimer, furi_ms_to_ticks(2000));
+        splashView = nullptr;
+    }
+    else
+    {
+        // Draw callbacks receive the view model, not the context
+        view_allocate_model(splashView, ViewModelTypeLockFree, sizeof(const uint8_t *));
+        auto **bitmap = static_cast<const uint8_t **>(view_get_model(splashView));
+        *bitmap = splashBitmap.get();
+        view_commit_model(splashView, false);
     }
 
-    view_dispatcher_switch_to_view(viewDispatcher, splashView ? GolfScoreViewSplash : GolfScoreViewSubmenu);
-
-    if (!splashView)
+    if (splashView)
     {
-        splashFinished = true;
-        view_dispatcher_switch_to_view(viewDispatcher, GolfScoreViewSubmenu);
+        // The splash stays up only while the dispatcher works through this event
+        golf_score_switch_view(viewDispatcher, GolfScoreViewSplash);
+        view_dispatcher_send_custom_event(viewDispatcher, StateLoadEventId);
+    }
+    else
+    {
+        loadState();
+        stateLoaded = true;
+        dismissSplash();
     }
 }
 
 GolfScoreApp::~GolfScoreApp()
 {
+    GOLF_SCORE_TRACE_DUMP();
+    golf_score_latency_save();
     dismissSplash();
 
     if (timer)
@@ -140,6 +442,11 @@ GolfScoreApp::~GolfScoreApp()
         about.reset();
     }
 
+    if (summary)
+    {
+        summary.reset();
+    }
+
     if (submenu)
     {
         view_dispatcher_remove_view(viewDispatcher, GolfScoreViewSubmenu);
@@ -168,6 +475,9 @@ void GolfScoreApp::callbackSubmenuChoices(uint32_t index)
     switch (index)
     {
     case GolfScoreMenuRun:
+    {
+        // The scorecard is a view port over the dispatcher, not a view
+        GOLF_SCORE_TRACE_SCOPE("scorecard_open");
         if (!scorecard)
         {
             scorecard = std::make_unique<GolfScoreScorecard>(this);
@@ -191,19 +501,20 @@ void GolfScoreApp::callbackSubmenuChoices(uint32_t index)
             furi_timer_start(timer, 100);
         }
         break;
+    }
     case GolfScoreMenuSettings:
         if (!settings)
         {
             settings = std::make_unique<GolfScoreSettings>(&viewDispatcher, this);
         }
-        view_dispatcher_switch_to_view(viewDispatcher, GolfScoreViewSettings);
+        golf_score_switch_view(viewDispatcher, GolfScoreViewSettings);
         break;
     case GolfScoreMenuAbout:
         if (!about)
         {
             about = std::make_unique<GolfScoreAbout>(&viewDispatcher);
         }
-        view_dispatcher_switch_to_view(viewDispatcher, GolfScoreViewAbout);
+        golf_score_switch_view(viewDispatcher, GolfScoreViewAbout);
         break;
     default:
         break;
@@ -231,41 +542,28 @@ void GolfScoreApp::applyDefaults()
     state.version = StateVersion;
     state.playerCount = 1;
     state.holeCount = 9;
-    state.reserved = 0;
-
-    for (auto &name : state.playerNames)
-    {
-        name.fill('\0');
-    }
-
-    for (auto &scores : state.strokes)
-    {
-        scores.fill(0);
-    }
-
-    state.par.fill(GolfScoreDefaultPar);
-
-    for (auto &course : state.courses)
-    {
-        course.holeCount = 0;
-        course.par.fill(0);
-        course.name.fill('\0');
-    }
-
-    state.activeCourse = InvalidCourseIndex;
-
-    for (uint8_t i = 0; i < MaxPlayers; ++i)
-    {
-        ensureName(i);
-    }
-
+    state.generation = 0;
+    state.activeCourse = InvalidCourseId;
+    state.activeCourseName.fill('\0');
+    state.format = GolfScoreFormatStroke;
+    format = golf_score_make_format(GolfScoreFormatStroke);
+    state.teamMode = GolfScoreTeamsOff;
+
+    round = GolfScoreRound{};
+    round.resize(1, state.holeCount);
+    ensureName(0);
+
+    rebuildAggregates();
     roundSaved = false;
 }
 
 void GolfScoreApp::loadState()
 {
+    GOLF_SCORE_MEMORY_PROBE("load");
     PersistentState persisted{};
-    if (!readStateFromFile(persisted))
+    GolfScoreRound players;
+    auto legacy = std::make_unique<LegacyCourses>();
+    if (!legacy || !readStateFromFile(persisted, players, *legacy))
     {
         saveState();
         return;
@@ -278,76 +576,335 @@ void GolfScoreApp::loadState()
     }
 
     state = persisted;
+    round = std::move(players);
+    state.playerCount = round.playerCount();
+    state.holeCount = round.holeCount();
 
-    if (state.playerCount < 1 || state.playerCount > MaxPlayers)
+    for (uint8_t hole = 0; hole < round.holeCount(); ++hole)
     {
-        state.playerCount = 1;
+        uint8_t par = round.getPar(hole);
+        if (par < GolfScoreMinPar || par > GolfScoreMaxPar)
+        {
+            round.setPar(hole, GolfScoreDefaultPar);
+        }
     }
+    round.rankStrokeIndices();
 
-    if (state.holeCount < 1 || state.holeCount > MaxHoles)
+    state.activeCourseName.back() = '\0';
+    if (state.format >= GolfScoreFormatCount)
+    {
+        state.format = GolfScoreFormatStroke;
+    }
+    format = golf_score_make_format(getFormat());
+    if (state.teamMode >= GolfScoreTeamsModeCount)
     {
-        state.holeCount = 9;
+        state.teamMode = GolfScoreTeamsOff;
+    }
+    if (state.activeCourse == InvalidCourseId)
+    {
+        state.activeCourseName.fill('\0');
     }
 
-    for (size_t hole = 0; hole < MaxHoles; ++hole)
+    for (uint8_t i = 0; i < round.playerCount(); ++i)
     {
-        uint8_t par = state.par[hole];
-        if (par < GolfScoreMinPar || par > GolfScoreMaxPar)
+        round.name(i)[MaxNameLength - 1] = '\0';
+        ensureName(i);
+        round.setHandicap(i, std::clamp(round.getHandicap(i), GolfScoreMinHandicap, GolfScoreMaxHandicap));
+        if (round.getTeam(i) >= GolfScoreMaxTeams)
         {
-            state.par[hole] = GolfScoreDefaultPar;
+            round.setTeam(i, GolfScoreNoTeam);
         }
     }
+    GolfScoreHoleEntry *entries = round.entryData();
+    for (size_t i = 0; i < static_cast<size_t>(round.holeCount()) * round.playerCount(); ++i)
+    {
+        entries[i] = golf_score_valid_entry(entries[i]);
+    }
+    round.rebuildAllowances();
+
+    journalGeneration = state.generation;
+    uint16_t replayed = replayJournal();
+
+    rebuildAggregates();
+    roundSaved = false;
+
+    if (legacy->present)
+    {
+        importLegacyCourses(*legacy);
+    }
 
-    for (size_t courseIndex = 0; courseIndex < state.courses.size(); ++courseIndex)
+    // Fold the journal into a fresh snapshot
+    if (legacy->present || replayed > 0)
     {
-        auto &course = state.courses[courseIndex];
-        if (course.holeCount < 1 || course.holeCount > MaxHoles)
+        saveState();
+    }
+}
+
+void GolfScoreApp::importLegacyCourses(const LegacyCourses &legacy)
+{
+    for (size_t i = 0; i < legacy.courses.size(); ++i)
+    {
+        const CoursePresetV2 &preset = legacy.courses[i];
+        if (preset.holeCount < 1 || preset.holeCount > LegacyMaxHoles)
         {
-            course.holeCount = 0;
+            continue;
         }
 
-        for (size_t hole = 0; hole < MaxHoles; ++hole)
+        GolfScoreCourse course;
+        course.holeCount = preset.holeCount;
+        for (size_t hole = 0; hole < LegacyMaxHoles; ++hole)
         {
-            uint8_t par = course.par[hole];
-            if (par < GolfScoreMinPar || par > GolfScoreMaxPar)
-            {
-                course.par[hole] = GolfScoreDefaultPar;
-            }
+            uint8_t par = preset.par[hole];
+            course.par[hole] = (par < GolfScoreMinPar || par > GolfScoreMaxPar) ? GolfScoreDefaultPar : par;
+        }
+        course.name = preset.name;
+        course.name.back() = '\0';
+        if (course.name[0] == '\0')
+        {
+            snprintf(course.name.data(), course.name.size(), "Course %u", static_cast<unsigned>(i + 1));
         }
 
-        if (course.holeCount == 0)
+        // Importing twice (e.g. after a failed state write) updates rather than duplicates
+        GolfScoreCourseEntry existing;
+        if (courses.findByName(course.name.data(), existing))
         {
-            course.par.fill(0);
-            course.name.fill('\0');
+            course.id = existing.id;
         }
-        else if (course.name[0] == '\0')
+
+        uint16_t id = courses.save(course);
+        if (id != InvalidCourseId && i == legacy.active)
         {
-            snprintf(course.name.data(), course.name.size(), "Course %u", static_cast<unsigned>(courseIndex + 1));
+            state.activeCourse = id;
+            state.activeCourseName = course.name;
         }
     }
+}
 
-    if (state.activeCourse >= GolfScoreMaxCourses || !courseSlotInUse(state.activeCourse))
+void GolfScoreApp::saveState()
+{
+    GOLF_SCORE_MEMORY_PROBE("save");
+    GOLF_SCORE_TRACE_SCOPE("saveState");
+    uint32_t start = golf_score_perf_cycles();
+    PersistentState copy = state;
+    copy.version = StateVersion;
+    copy.playerCount = round.playerCount();
+    copy.holeCount = round.holeCount();
+    // The new generation orphans the old journal even if clearing it fails
+    copy.generation = static_cast<uint8_t>(journalGeneration + 1);
+    if (writeStateToFile(copy, round))
+    {
+        journalGeneration = copy.generation;
+        state.generation = copy.generation;
+        if (!resetJournal())
+        {
+            // The old journal is stale now and appends to it would be
+            // dropped on load; edits go through full saves until a reset works
+            FURI_LOG_E(TAG, "Journal reset failed, saving full state");
+            journalEntries = JournalCompactEntries;
+        }
+    }
+    golf_score_perf.saveUs = golf_score_perf_elapsed_us(start);
+    golf_score_latency_record(GolfScoreLatencySave, golf_score_perf.saveUs);
+}
+
+bool GolfScoreApp::resetJournal()
+{
+    journalEntries = 0;
+
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
     {
-        state.activeCourse = InvalidCourseIndex;
+        return false;
     }
 
-    for (uint8_t i = 0; i < MaxPlayers; ++i)
+    File *file = storage_file_alloc(storage);
+    char path[256];
+    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, JournalFileName);
+    bool result = false;
+    if (file && storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS))
     {
-        ensureName(i);
+        JournalHeader header;
+        header.generation = journalGeneration;
+        result = golf_score_file_write(file, &header, sizeof(header)) == sizeof(header);
+
+        // Carry the undo ring over, newest redo op undone first
+        std::array<JournalRecord, GolfScoreUndoDepth * 2> records;
+        size_t count = 0;
+        for (uint8_t i = 0; i < undo.size(); ++i)
+        {
+            records[count++] = JournalRecord{JournalHistory, JournalCarried, undo.at(i)};
+        }
+        for (uint8_t i = undo.size(); i > undo.applied(); --i)
+        {
+            records[count++] = JournalRecord{JournalUndo, JournalCarried, undo.at(static_cast<uint8_t>(i - 1))};
+        }
+        if (result && count > 0)
+        {
+            result = golf_score_file_write(file, records.data(), count * sizeof(JournalRecord)) == count * sizeof(JournalRecord);
+            journalEntries = static_cast<uint16_t>(count);
+        }
+        storage_file_close(file);
     }
 
-    roundSaved = false;
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+    return result;
 }
 
-void GolfScoreApp::saveState() const
+void GolfScoreApp::journalEntry(uint8_t kind, const GolfScoreEditOp &op)
 {
-    PersistentState copy = state;
-    copy.version = StateVersion;
-    copy.reserved = 0;
-    writeStateToFile(copy);
+    if (journalEntries >= JournalCompactEntries)
+    {
+        saveState();
+        return;
+    }
+
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        return;
+    }
+
+    File *file = storage_file_alloc(storage);
+    char path[256];
+    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, JournalFileName);
+
+    bool written = false;
+    if (file && storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_APPEND))
+    {
+        JournalRecord record{kind, 0, op};
+        bool headerOk = true;
+        if (storage_file_size(file) == 0)
+        {
+            JournalHeader header;
+            header.generation = journalGeneration;
+            headerOk = golf_score_file_write(file, &header, sizeof(header)) == sizeof(header);
+        }
+        written = headerOk && golf_score_file_write(file, &record, sizeof(record)) == sizeof(record);
+        storage_file_close(file);
+    }
+
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+
+    if (written)
+    {
+        ++journalEntries;
+    }
+    else
+    {
+        FURI_LOG_E(TAG, "Journal append failed, saving full state");
+        saveState();
+    }
+}
+
+uint16_t GolfScoreApp::replayJournal()
+{
+    journalEntries = 0;
+    undo.clear();
+
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        return 0;
+    }
+
+    File *file = storage_file_alloc(storage);
+    char path[256];
+    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, JournalFileName);
+
+    uint16_t records = 0;
+    uint16_t replayed = 0;
+    uint32_t scanned = 0;
+    if (file && storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING))
+    {
+        JournalHeader header;
+        bool current = storage_file_read(file, &header, sizeof(header)) == sizeof(header) && header.generation == journalGeneration;
+        if (current && header.magic == JournalMagic)
+        {
+            JournalRecord buffer[16];
+            size_t bytes;
+            while (scanned < JournalReplayLimit && (bytes = storage_file_read(file, buffer, sizeof(buffer))) >= sizeof(JournalRecord))
+            {
+                scanned += bytes / sizeof(JournalRecord);
+                for (size_t i = 0; i < bytes / sizeof(JournalRecord); ++i)
+                {
+                    const JournalRecord &record = buffer[i];
+                    GolfScoreEditOp op = record.op;
+                    if (op.player >= round.playerCount() || op.hole >= round.holeCount())
+                    {
+                        continue;
+                    }
+                    op.before = golf_score_valid_entry(op.before);
+                    op.after = golf_score_valid_entry(op.after);
+
+                    GolfScoreEditOp step;
+                    switch (record.kind)
+                    {
+                    case JournalEdit:
+                        round.entry(op.player, op.hole) = op.after;
+                        undo.push(op);
+                        ++replayed;
+                        break;
+                    case JournalUndo:
+                        round.entry(op.player, op.hole) = op.before;
+                        undo.undo(step);
+                        replayed += (record.flags & JournalCarried) ? 0 : 1;
+                        break;
+                    case JournalRedo:
+                        round.entry(op.player, op.hole) = op.after;
+                        undo.redo(step);
+                        ++replayed;
+                        break;
+                    case JournalHistory:
+                        undo.push(op);
+                        break;
+                    default:
+                        continue;
+                    }
+                    ++records;
+                }
+            }
+        }
+        else if (current && header.magic == JournalMagicV1)
+        {
+            JournalRecordV1 buffer[16];
+            size_t bytes;
+            while (scanned < JournalReplayLimit && (bytes = storage_file_read(file, buffer, sizeof(buffer))) >= sizeof(JournalRecordV1))
+            {
+                scanned += bytes / sizeof(JournalRecordV1);
+                for (size_t i = 0; i < bytes / sizeof(JournalRecordV1); ++i)
+                {
+                    const JournalRecordV1 &record = buffer[i];
+                    if (record.player < round.playerCount() && record.hole < round.holeCount())
+                    {
+                        round.entry(record.player, record.hole) = golf_score_valid_entry(record.entry);
+                        ++replayed;
+                        ++records;
+                    }
+                }
+            }
+        }
+        storage_file_close(file);
+    }
+
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+
+    journalEntries = records;
+    return replayed;
 }
 
-bool GolfScoreApp::writeStateToFile(const PersistentState &data) const
+bool GolfScoreApp::writeStateToFile(const PersistentState &data, const GolfScoreRound &players) const
 {
     Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
     if (!storage)
@@ -368,7 +925,13 @@ bool GolfScoreApp::writeStateToFile(const PersistentState &data) const
     bool result = false;
     if (storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS))
     {
-        result = storage_file_write(file, &data, sizeof(PersistentState)) == sizeof(PersistentState);
+        result = golf_score_file_write(file, &data, sizeof(PersistentState)) == sizeof(PersistentState) &&
+                 golf_score_file_write(file, players.parData(), players.parBytes()) == players.parBytes() &&
+                 golf_score_file_write(file, players.strokeIndexData(), players.strokeIndexBytes()) == players.strokeIndexBytes() &&
+                 golf_score_file_write(file, players.nameData(), players.nameBytes()) == players.nameBytes() &&
+                 golf_score_file_write(file, players.handicapData(), players.handicapBytes()) == players.handicapBytes() &&
+                 golf_score_file_write(file, players.teamData(), players.teamBytes()) == players.teamBytes() &&
+                 golf_score_file_write(file, players.entryData(), players.entryBytes()) == players.entryBytes();
         storage_file_close(file);
     }
 
@@ -377,7 +940,7 @@ bool GolfScoreApp::writeStateToFile(const PersistentState &data) const
     return result;
 }
 
-bool GolfScoreApp::readStateFromFile(PersistentState &data) const
+bool GolfScoreApp::readStateFromFile(PersistentState &data, GolfScoreRound &players, LegacyCourses &legacy) const
 {
     Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
     if (!storage)
@@ -398,32 +961,124 @@ bool GolfScoreApp::readStateFromFile(PersistentState &data) const
     bool result = false;
     if (storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING))
     {
-        if (storage_file_read(file, &data, sizeof(PersistentState)) == sizeof(PersistentState))
+        uint64_t size = storage_file_size(file);
+        uint8_t version = 0;
+        storage_file_read(file, &version, sizeof(version));
+        storage_file_seek(file, 0, true);
+
+        if (version >= 5 && version <= StateVersion)
         {
-            result = true;
+            // Versions 5 and 6 had a shorter header, version 5 stored one
+            // stroke byte per hole entry, versions before 8 had no stroke
+            // indices or handicaps and versions before 9 no teams (resize()
+            // supplies the defaults)
+            bool header = false;
+            if (version >= 7)
+            {
+                header = storage_file_read(file, &data, sizeof(PersistentState)) == sizeof(PersistentState);
+            }
+            else
+            {
+                PersistentStateV6 old;
+                header = storage_file_read(file, &old, sizeof(PersistentStateV6)) == sizeof(PersistentStateV6);
+                data = PersistentState{};
+                data.playerCount = old.playerCount;
+                data.holeCount = old.holeCount;
+                data.generation = old.generation;
+                data.activeCourse = old.activeCourse;
+                data.activeCourseName = old.activeCourseName;
+            }
+
+            if (header && data.playerCount >= 1 && data.playerCount <= MaxPlayers && data.holeCount >= 1 && data.holeCount <= MaxHoles &&
+                players.resize(data.playerCount, data.holeCount))
+            {
+                bool handicaps = version >= 8;
+                result = storage_file_read(file, players.parData(), players.parBytes()) == players.parBytes() &&
+                         (!handicaps || storage_file_read(file, players.strokeIndexData(), players.strokeIndexBytes()) == players.strokeIndexBytes()) &&
+                         storage_file_read(file, players.nameData(), players.nameBytes()) == players.nameBytes() &&
+                         (!handicaps || storage_file_read(file, players.handicapData(), players.handicapBytes()) == players.handicapBytes()) &&
+                         (version < 9 || storage_file_read(file, players.teamData(), players.teamBytes()) == players.teamBytes()) &&
+                         (version == 5 ? read_stroke_bytes(file, players)
+                                       : storage_file_read(file, players.entryData(), players.entryBytes()) == players.entryBytes());
+                data.version = StateVersion;
+            }
         }
-        else
+        else if (version == 3 || version == 4)
+        {
+            // The player block is stored over a fixed 18 holes; version 3
+            // also carries the presets that move to the course library
+            auto old = std::make_unique<PersistentStateV4>();
+            auto v3 = std::make_unique<PersistentStateV3>();
+            bool header = false;
+            if (old && v3 && version == 4)
+            {
+                header = storage_file_read(file, old.get(), sizeof(PersistentStateV4)) == sizeof(PersistentStateV4);
+            }
+            else if (old && v3 && storage_file_read(file, v3.get(), sizeof(PersistentStateV3)) == sizeof(PersistentStateV3))
+            {
+                old->playerCount = v3->playerCount;
+                old->holeCount = v3->holeCount;
+                old->par = v3->par;
+                legacy.courses = v3->courses;
+                legacy.active = v3->activeCourse;
+                legacy.present = true;
+                header = true;
+            }
+
+            if (header && old->playerCount >= 1 && old->playerCount <= MaxPlayers && players.resize(old->playerCount, LegacyMaxHoles))
+            {
+                data = PersistentState{};
+                data.version = StateVersion;
+                data.playerCount = old->playerCount;
+                data.holeCount = std::clamp<uint8_t>(old->holeCount, 1, LegacyMaxHoles);
+                data.activeCourse = old->activeCourse;
+                data.activeCourseName = old->activeCourseName;
+                memcpy(players.parData(), old->par.data(), LegacyMaxHoles);
+                result = storage_file_read(file, players.nameData(), players.nameBytes()) == players.nameBytes() &&
+                         read_stroke_bytes(file, players) &&
+                         players.resize(data.playerCount, data.holeCount);
+            }
+        }
+        else if (version <= 2)
         {
-            storage_file_seek(file, 0, true);
-            PersistentStateV1 legacy{};
-            if (storage_file_read(file, &legacy, sizeof(PersistentStateV1)) == sizeof(PersistentStateV1))
+            // Versions 1 and 2 (0 from builds that left it unset): migrate
+            // the fixed four-player block. Versions newer than this build
+            // are not guessed at.
+            auto old = std::make_unique<PersistentStateV2>();
+            size_t expected = version == 2 ? sizeof(PersistentStateV2) : sizeof(PersistentStateV1);
+            if (old && size >= expected && storage_file_read(file, old.get(), expected) == expected)
             {
+                const PersistentStateV1 &base = old->base;
+                uint8_t count = std::clamp<uint8_t>(base.playerCount, 1, LegacyMaxPlayers);
+
                 data = PersistentState{};
                 data.version = StateVersion;
-                data.playerCount = legacy.playerCount;
-                data.holeCount = legacy.holeCount;
-                data.reserved = 0;
-                data.playerNames = legacy.playerNames;
-                data.strokes = legacy.strokes;
-                data.par = legacy.par;
-                for (auto &course : data.courses)
+                data.playerCount = count;
+                data.holeCount = std::clamp<uint8_t>(base.holeCount, 1, LegacyMaxHoles);
+
+                if (version == 2)
                 {
-                    course.holeCount = 0;
-                    course.par.fill(0);
-                    course.name.fill('\0');
+                    legacy.courses = old->courses;
+                    legacy.active = old->activeCourse;
+                    legacy.present = true;
+                }
+
+                if (players.resize(count, data.holeCount))
+                {
+                    for (uint8_t hole = 0; hole < data.holeCount; ++hole)
+                    {
+                        players.setPar(hole, base.par[hole]);
+                    }
+                    for (uint8_t player = 0; player < count; ++player)
+                    {
+                        memcpy(players.name(player), base.playerNames[player].data(), MaxNameLength);
+                        for (uint8_t hole = 0; hole < data.holeCount; ++hole)
+                        {
+                            players.setStrokes(player, hole, std::min(base.strokes[player][hole], GolfScoreMaxStrokes));
+                        }
+                    }
+                    result = true;
                 }
-                data.activeCourse = InvalidCourseIndex;
-                result = true;
             }
         }
         storage_file_close(file);
@@ -436,15 +1091,15 @@ bool GolfScoreApp::readStateFromFile(PersistentState &data) const
 
 void GolfScoreApp::ensureName(uint8_t index)
 {
-    if (index >= MaxPlayers)
+    if (index >= round.playerCount())
     {
         return;
     }
 
-    auto &name = state.playerNames[index];
+    char *name = round.name(index);
     if (name[0] == '\0')
     {
-        snprintf(name.data(), name.size(), "Player %u", static_cast<unsigned>(index + 1));
+        snprintf(name, MaxNameLength, "Player %u", static_cast<unsigned>(index + 1));
     }
 }
 
@@ -494,33 +1149,50 @@ void GolfScoreApp::timerCallback(void *context)
                 app->viewPort = nullptr;
             }
 
-            view_dispatcher_switch_to_view(app->viewDispatcher, GolfScoreViewSubmenu);
+            // A finished round hands over to the summary view instead
+            if (!app->summaryPending && !(app->summary && app->summary->isActive()))
+            {
+                golf_score_switch_view(app->viewDispatcher, GolfScoreViewSubmenu);
+            }
             app->scorecard.reset();
         }
     }
 }
 
-void GolfScoreApp::splashTimerCallback(void *context)
+void GolfScoreApp::splashDraw(Canvas *canvas, void *model)
 {
-    auto *app = static_cast<GolfScoreApp *>(context);
-    if (!app || !app->viewDispatcher)
+    const uint8_t *bitmap = model ? *static_cast<const uint8_t **>(model) : nullptr;
+    if (!canvas)
     {
         return;
     }
 
-    view_dispatcher_send_custom_event(app->viewDispatcher, SplashEventId);
+    canvas_clear(canvas);
+    if (bitmap)
+    {
+        canvas_draw_xbm(canvas, 0, 0, SPLASH_SCREEN_WIDTH, SPLASH_SCREEN_HEIGHT, bitmap);
+    }
+    else
+    {
+        canvas_set_font_custom(canvas, FONT_SIZE_LARGE);
+        canvas_draw_str(canvas, 2, 13, VERSION_TAG);
+    }
 }
 
-void GolfScoreApp::splashDraw(Canvas *canvas, void *context)
+bool GolfScoreApp::splashInput(InputEvent *event, void *context)
 {
-    UNUSED(context);
-    if (!canvas)
+    auto *app = static_cast<GolfScoreApp *>(context);
+    if (!app || !event)
     {
-        return;
+        return false;
     }
 
-    canvas_clear(canvas);
-    canvas_draw_xbm(canvas, 0, 0, SPLASH_SCREEN_WIDTH, SPLASH_SCREEN_HEIGHT, SplashScreenBitmap);
+    // Dismiss through the event queue so the view is never freed inside its own input callback
+    if (event->type == InputTypeShort && app->viewDispatcher)
+    {
+        view_dispatcher_send_custom_event(app->viewDispatcher, SplashEventId);
+    }
+    return true;
 }
 
 bool GolfScoreApp::splashEventCallback(void *context, uint32_t event)
@@ -531,8 +1203,13 @@ bool GolfScoreApp::splashEventCallback(void *context, uint32_t event)
         return false;
     }
 
-    if (event == SplashEventId)
+    if (event == StateLoadEventId || event == SplashEventId)
     {
+        if (!app->stateLoaded)
+        {
+            app->loadState();
+            app->stateLoaded = true;
+        }
         app->dismissSplash();
         return true;
     }
@@ -541,8 +1218,15 @@ bool GolfScoreApp::splashEventCallback(void *context, uint32_t event)
     {
         if (app->summaryPending)
         {
-            easy_flipper_dialog("Round Saved", app->summaryBuffer.data());
             app->summaryPending = false;
+            if (!app->summary)
+            {
+                app->summary = std::make_unique<GolfScoreSummary>(&app->viewDispatcher);
+            }
+            if (!app->summary->show(std::move(app->roundSummary)))
+            {
+                golf_score_switch_view(app->viewDispatcher, GolfScoreViewSubmenu);
+            }
         }
         return true;
     }
@@ -552,207 +1236,476 @@ bool GolfScoreApp::splashEventCallback(void *context, uint32_t event)
 
 void GolfScoreApp::dismissSplash()
 {
-    if (splashFinished)
+    if (!splashFinished)
     {
-        if (splashTimer)
+        splashFinished = true;
+
+        if (viewDispatcher)
         {
-            furi_timer_stop(splashTimer);
-            furi_timer_free(splashTimer);
-            splashTimer = nullptr;
+            golf_score_switch_view(viewDispatcher, GolfScoreViewSubmenu);
         }
-        if (splashView)
+
+        uint32_t elapsed = furi_get_tick() - constructedTick;
+        uint32_t frequency = furi_kernel_get_tick_frequency();
+        FURI_LOG_I(TAG, "Interactive after %lu ms", static_cast<unsigned long>(frequency ? (elapsed * 1000UL) / frequency : elapsed));
+    }
+
+    if (splashView)
+    {
+        view_dispatcher_remove_view(viewDispatcher, GolfScoreViewSplash);
+        view_free(splashView);
+        splashView = nullptr;
+    }
+
+    splashBitmap.reset();
+}
+
+void GolfScoreApp::viewPortDraw(Canvas *canvas, void *context)
+{
+    auto *app = static_cast<GolfScoreApp *>(context);
+    if (!app)
+    {
+        return;
+    }
+
+    auto scorecard_ptr = app->scorecard.get();
+    if (scorecard_ptr && scorecard_ptr->isActive())
+    {
+        scorecard_ptr->updateDraw(canvas);
+        golf_score_perf_drawn();
+    }
+}
+
+void GolfScoreApp::viewPortInput(InputEvent *event, void *context)
+{
+    auto *app = static_cast<GolfScoreApp *>(context);
+    if (!app)
+    {
+        return;
+    }
+
+    auto scorecard_ptr = app->scorecard.get();
+    if (scorecard_ptr && scorecard_ptr->isActive())
+    {
+        // Press and release change nothing; the short, long or repeat that
+        // follows is what the next frame answers
+        if (event->type != InputTypePress && event->type != InputTypeRelease)
         {
-            view_dispatcher_remove_view(viewDispatcher, GolfScoreViewSplash);
-            view_free(splashView);
-            splashView = nullptr;
+            golf_score_perf_input();
         }
+        scorecard_ptr->updateInput(event);
+    }
+}
+
+const char *GolfScoreApp::getPlayerName(uint8_t index) const
+{
+    if (index >= round.playerCount())
+    {
+        static const char *empty = "";
+        return empty;
+    }
+    return round.name(index);
+}
+
+uint8_t GolfScoreApp::getScore(uint8_t player, uint8_t hole) const
+{
+    if (player >= round.playerCount() || hole >= round.holeCount())
+    {
+        return 0;
+    }
+    return round.getStrokes(player, hole);
+}
+
+uint16_t GolfScoreApp::getTotalScore(uint8_t player) const
+{
+    if (player >= round.playerCount())
+    {
+        return 0;
+    }
+    return round.aggregate(player).total;
+}
+
+int16_t GolfScoreApp::getRelativeToPar(uint8_t player) const
+{
+    if (player >= round.playerCount() || round.aggregate(player).parPlayed == 0)
+    {
+        return 0;
+    }
+    const GolfScorePlayerAggregate &aggregate = round.aggregate(player);
+    return static_cast<int16_t>(aggregate.total - aggregate.parPlayed);
+}
+
+uint8_t GolfScoreApp::getPar(uint8_t hole) const
+{
+    if (hole >= round.holeCount())
+    {
+        return 0;
+    }
+    uint8_t par = round.getPar(hole);
+    if (par < GolfScoreMinPar || par > GolfScoreMaxPar)
+    {
+        return GolfScoreDefaultPar;
+    }
+    return par;
+}
+
+uint16_t GolfScoreApp::getCoursePar() const
+{
+    return round.kernels().coursePar(round);
+}
+
+uint8_t GolfScoreApp::getPlayedHoleCount(uint8_t player) const
+{
+    if (player >= round.playerCount())
+    {
+        return 0;
+    }
+    return round.aggregate(player).played;
+}
+
+int16_t GolfScoreApp::getNetTotal(uint8_t player) const
+{
+    return player < round.playerCount() ? round.aggregate(player).net : 0;
+}
+
+int16_t GolfScoreApp::getNetRelativeToPar(uint8_t player) const
+{
+    if (player >= round.playerCount() || round.aggregate(player).parPlayed == 0)
+    {
+        return 0;
+    }
+    const GolfScorePlayerAggregate &aggregate = round.aggregate(player);
+    return static_cast<int16_t>(aggregate.net - aggregate.parPlayed);
+}
+
+int8_t GolfScoreApp::getHandicap(uint8_t player) const
+{
+    return player < round.playerCount() ? round.getHandicap(player) : 0;
+}
+
+void GolfScoreApp::setHandicap(uint8_t player, int8_t handicap)
+{
+    handicap = std::clamp(handicap, GolfScoreMinHandicap, GolfScoreMaxHandicap);
+    if (player >= round.playerCount() || round.getHandicap(player) == handicap)
+    {
         return;
     }
 
-    splashFinished = true;
+    round.setHandicap(player, handicap);
+    round.rebuildAllowances();
+    rebuildAggregates();
+    roundSaved = false;
+    saveState();
+    requestCanvasRefresh();
+}
+
+uint8_t GolfScoreApp::getStrokeIndex(uint8_t hole) const
+{
+    return hole < round.holeCount() ? round.getStrokeIndex(hole) : 0;
+}
 
-    if (splashTimer)
+void GolfScoreApp::setStrokeIndex(uint8_t hole, uint8_t strokeIndex)
+{
+    if (hole >= round.holeCount() || strokeIndex < 1 || strokeIndex > round.holeCount() || round.getStrokeIndex(hole) == strokeIndex)
     {
-        furi_timer_stop(splashTimer);
-        furi_timer_free(splashTimer);
-        splashTimer = nullptr;
+        return;
     }
 
-    if (viewDispatcher)
+    // Each index belongs to one hole: the hole that had it takes this one's
+    for (uint8_t other = 0; other < round.holeCount(); ++other)
     {
-        view_dispatcher_switch_to_view(viewDispatcher, GolfScoreViewSubmenu);
+        if (round.getStrokeIndex(other) == strokeIndex)
+        {
+            round.setStrokeIndex(other, round.getStrokeIndex(hole));
+            break;
+        }
     }
+    round.setStrokeIndex(hole, strokeIndex);
+    round.rebuildAllowances();
+    rebuildAggregates();
+    roundSaved = false;
+    saveState();
+    requestCanvasRefresh();
+}
 
-    if (splashView)
+void GolfScoreApp::rebuildAggregates()
+{
+    round.kernels().rebuildAggregates(round);
+    if (format)
+    {
+        format->reset(round);
+    }
+    teams.reset(round, getTeamMode());
+}
+
+void GolfScoreApp::rebuildAggregate(uint8_t player)
+{
+    round.kernels().rebuildAggregate(round, player);
+}
+
+bool GolfScoreApp::applyEntry(uint8_t player, uint8_t hole, GolfScoreHoleEntry entry)
+{
+    if (player >= round.playerCount() || hole >= round.holeCount())
+    {
+        return false;
+    }
+
+    GolfScoreHoleEntry previousEntry = round.entry(player, hole);
+    if (entry == previousEntry)
+    {
+        return false;
+    }
+    round.entry(player, hole) = entry;
+
+    // Details first: a best-hole rebuild below recounts them from the card
+    GolfScorePlayerAggregate &aggregate = round.aggregate(player);
+    aggregate.countDetails(previousEntry, -1);
+    aggregate.countDetails(entry, 1);
+
+    uint8_t previous = previousEntry.strokes;
+    uint8_t strokes = entry.strokes;
+    if (strokes != previous)
+    {
+        if (format)
+        {
+            format->update(round, player, hole, previous);
+        }
+        teams.update(round, player, hole, previous);
+
+        uint8_t par = getPar(hole);
+        aggregate.total = static_cast<uint16_t>(aggregate.total - previous + strokes);
+        aggregate.net = static_cast<int16_t>(aggregate.net - round.netStrokes(player, hole, previous) + round.netStrokes(player, hole, strokes));
+        (hole < golf_score_front_holes(round.holeCount()) ? aggregate.front : aggregate.back) += static_cast<uint16_t>(strokes - previous);
+        if (previous == 0)
+        {
+            ++aggregate.played;
+            aggregate.parPlayed += par;
+        }
+        else if (strokes == 0)
+        {
+            --aggregate.played;
+            aggregate.parPlayed -= par;
+        }
+
+        if (aggregate.bestHole == hole)
+        {
+            // The best hole got worse or was cleared; another hole may now lead
+            if (strokes == 0 || strokes > previous)
+            {
+                rebuildAggregate(player);
+            }
+        }
+        else if (strokes > 0)
+        {
+            int relative = static_cast<int>(strokes) - par;
+            uint8_t bestHole = aggregate.bestHole;
+            int best = bestHole == 0xFF ? 0 : static_cast<int>(round.getStrokes(player, bestHole)) - getPar(bestHole);
+            if (bestHole == 0xFF || relative < best || (relative == best && hole < bestHole))
+            {
+                aggregate.bestHole = hole;
+            }
+        }
+    }
+
+    roundSaved = false;
+    requestCanvasRefresh();
+    return true;
+}
+
+void GolfScoreApp::recordEdit(uint8_t player, uint8_t hole, GolfScoreHoleEntry entry)
+{
+    GolfScoreEditOp op{player, hole, round.entry(player, hole), entry};
+    if (applyEntry(player, hole, entry))
     {
-        view_dispatcher_remove_view(viewDispatcher, GolfScoreViewSplash);
-        view_free(splashView);
-        splashView = nullptr;
+        undo.push(op);
+        journalEntry(JournalEdit, op);
     }
 }
 
-void GolfScoreApp::viewPortDraw(Canvas *canvas, void *context)
+void GolfScoreApp::adjustScore(uint8_t player, uint8_t hole, int8_t delta)
 {
-    auto *app = static_cast<GolfScoreApp *>(context);
-    if (!app)
+    if (player >= round.playerCount() || hole >= state.holeCount)
     {
         return;
     }
 
-    auto scorecard_ptr = app->scorecard.get();
-    if (scorecard_ptr && scorecard_ptr->isActive())
-    {
-        scorecard_ptr->updateDraw(canvas);
-    }
+    GolfScoreHoleEntry entry = round.entry(player, hole);
+    entry.strokes = std::clamp(static_cast<int>(entry.strokes) + delta, 0, static_cast<int>(GolfScoreMaxStrokes));
+    recordEdit(player, hole, entry);
 }
 
-void GolfScoreApp::viewPortInput(InputEvent *event, void *context)
+void GolfScoreApp::adjustStat(uint8_t player, uint8_t hole, GolfScoreHoleStat stat, int8_t delta)
 {
-    auto *app = static_cast<GolfScoreApp *>(context);
-    if (!app)
+    if (player >= round.playerCount() || hole >= state.holeCount)
     {
         return;
     }
 
-    auto scorecard_ptr = app->scorecard.get();
-    if (scorecard_ptr && scorecard_ptr->isActive())
+    GolfScoreHoleEntry entry = round.entry(player, hole);
+    switch (stat)
     {
-        scorecard_ptr->updateInput(event);
+    case GolfScoreStatPutts:
+        entry.putts = std::clamp(static_cast<int>(entry.putts) + delta, 0, static_cast<int>(GolfScoreMaxPutts));
+        break;
+    case GolfScoreStatFairway:
+        entry.fairway = (entry.fairway + 3 + delta % 3) % 3;
+        break;
+    case GolfScoreStatGreen:
+        entry.green = !entry.green;
+        break;
+    case GolfScoreStatPenalties:
+        entry.penalties = std::clamp(static_cast<int>(entry.penalties) + delta, 0, static_cast<int>(GolfScoreMaxPenalties));
+        break;
+    default:
+        return;
     }
+    recordEdit(player, hole, entry);
 }
 
-const char *GolfScoreApp::getPlayerName(uint8_t index) const
+bool GolfScoreApp::undoEdit(uint8_t &player, uint8_t &hole)
 {
-    if (index >= MaxPlayers)
+    GolfScoreEditOp op;
+    if (!undo.undo(op))
     {
-        static const char *empty = "";
-        return empty;
+        return false;
     }
-    return state.playerNames[index].data();
+
+    applyEntry(op.player, op.hole, op.before);
+    journalEntry(JournalUndo, op);
+    player = op.player;
+    hole = op.hole;
+    return true;
 }
 
-uint8_t GolfScoreApp::getScore(uint8_t player, uint8_t hole) const
+bool GolfScoreApp::redoEdit(uint8_t &player, uint8_t &hole)
 {
-    if (player >= MaxPlayers || hole >= MaxHoles || hole >= state.holeCount)
+    GolfScoreEditOp op;
+    if (!undo.redo(op))
     {
-        return 0;
+        return false;
     }
-    return state.strokes[player][hole];
+
+    applyEntry(op.player, op.hole, op.after);
+    journalEntry(JournalRedo, op);
+    player = op.player;
+    hole = op.hole;
+    return true;
 }
 
-uint16_t GolfScoreApp::getTotalScore(uint8_t player) const
+GolfScoreHoleEntry GolfScoreApp::getHoleEntry(uint8_t player, uint8_t hole) const
 {
-    if (player >= MaxPlayers)
+    if (player >= round.playerCount() || hole >= round.holeCount())
     {
-        return 0;
+        return GolfScoreHoleEntry{};
     }
+    return round.entry(player, hole);
+}
 
-    uint16_t total = 0;
-    for (size_t hole = 0; hole < state.holeCount; ++hole)
-    {
-        total += state.strokes[player][hole];
-    }
-    return total;
+const GolfScorePlayerAggregate *GolfScoreApp::getAggregate(uint8_t player) const
+{
+    return player < round.playerCount() ? &round.aggregate(player) : nullptr;
 }
 
-int16_t GolfScoreApp::getRelativeToPar(uint8_t player) const
+void GolfScoreApp::resetScores()
 {
-    if (player >= MaxPlayers)
-    {
-        return 0;
-    }
+    round.clearStrokes();
+    undo.clear();
+    rebuildAggregates();
+    roundSaved = false;
+    saveState();
+    requestCanvasRefresh();
+}
 
-    int16_t total = 0;
-    int16_t par_total = 0;
-    for (size_t hole = 0; hole < state.holeCount; ++hole)
+void GolfScoreApp::setFormat(GolfScoreFormatId id)
+{
+    if (id >= GolfScoreFormatCount || id == getFormat())
     {
-        uint8_t strokes = state.strokes[player][hole];
-        if (strokes > 0)
-        {
-            total += strokes;
-            par_total += state.par[hole];
-        }
+        return;
     }
 
-    if (par_total == 0)
+    auto next = golf_score_make_format(id);
+    if (!next)
     {
-        return 0;
+        FURI_LOG_E(TAG, "Failed to allocate scoring format %u", static_cast<unsigned>(id));
+        return;
     }
 
-    return total - par_total;
+    next->reset(round);
+    format = std::move(next);
+    state.format = id;
+    saveState();
+    requestCanvasRefresh();
 }
 
-uint8_t GolfScoreApp::getPar(uint8_t hole) const
+void GolfScoreApp::getStanding(uint8_t player, char *out, size_t size) const
 {
-    if (hole >= MaxHoles)
+    if (!out || size == 0)
     {
-        return 0;
+        return;
     }
-    uint8_t par = state.par[hole];
-    if (par < GolfScoreMinPar || par > GolfScoreMaxPar)
+    if (player >= round.playerCount() || !format)
     {
-        return GolfScoreDefaultPar;
+        snprintf(out, size, "--");
+        return;
     }
-    return par;
+    format->standing(round, player, out, size);
 }
 
-uint16_t GolfScoreApp::getCoursePar() const
+void GolfScoreApp::setTeamMode(GolfScoreTeamMode mode)
 {
-    uint16_t total = 0;
-    for (size_t hole = 0; hole < state.holeCount; ++hole)
+    if (mode >= GolfScoreTeamsModeCount || mode == getTeamMode())
     {
-        total += state.par[hole];
+        return;
     }
-    return total;
-}
 
-uint8_t GolfScoreApp::getPlayedHoleCount(uint8_t player) const
-{
-    if (player >= MaxPlayers)
+    // With nobody on a team yet, start from the usual sides: pairs for best
+    // ball, fours for aggregate
+    bool assigned = false;
+    for (uint8_t player = 0; player < round.playerCount(); ++player)
     {
-        return 0;
+        assigned = assigned || round.getTeam(player) != GolfScoreNoTeam;
     }
-
-    uint8_t count = 0;
-    for (size_t hole = 0; hole < state.holeCount; ++hole)
+    if (!assigned && mode != GolfScoreTeamsOff)
     {
-        if (state.strokes[player][hole] > 0)
+        uint8_t size = mode == GolfScoreTeamsBestBall ? 2 : 4;
+        for (uint8_t player = 0; player < round.playerCount(); ++player)
         {
-            ++count;
+            round.setTeam(player, static_cast<uint8_t>(player / size));
         }
     }
-    return count;
-}
-
-void GolfScoreApp::adjustScore(uint8_t player, uint8_t hole, int8_t delta)
-{
-    if (player >= state.playerCount || hole >= state.holeCount)
-    {
-        return;
-    }
 
-    int value = static_cast<int>(state.strokes[player][hole]);
-    value = std::clamp(value + delta, 0, 99);
-    state.strokes[player][hole] = static_cast<uint8_t>(value);
-    roundSaved = false;
+    state.teamMode = mode;
+    teams.reset(round, mode);
     saveState();
     requestCanvasRefresh();
 }
 
-void GolfScoreApp::resetScores()
+uint8_t GolfScoreApp::getTeam(uint8_t player) const
+{
+    return player < round.playerCount() ? round.getTeam(player) : GolfScoreNoTeam;
+}
+
+void GolfScoreApp::setTeam(uint8_t player, uint8_t team)
 {
-    for (auto &scores : state.strokes)
+    if (team >= GolfScoreMaxTeams)
     {
-        scores.fill(0);
+        team = GolfScoreNoTeam;
     }
-    roundSaved = false;
+    if (player >= round.playerCount() || round.getTeam(player) == team)
+    {
+        return;
+    }
+
+    round.setTeam(player, team);
+    teams.reset(round, getTeamMode());
     saveState();
     requestCanvasRefresh();
 }
 
 void GolfScoreApp::cyclePlayerCount()
 {
-    uint8_t next = state.playerCount >= MaxPlayers ? 1 : state.playerCount + 1;
+    uint8_t count = round.playerCount();
+    uint8_t next = count >= MaxPlayers ? 1 : count + 1;
     setPlayerCount(next);
 }
 
@@ -767,12 +1720,26 @@ void GolfScoreApp::setPlayerCount(uint8_t count)
         count = MaxPlayers;
     }
 
-    if (state.playerCount == count)
+    uint8_t previous = round.playerCount();
+    if (previous == count)
+    {
+        return;
+    }
+
+    if (!round.resize(count, round.holeCount()))
     {
+        FURI_LOG_E(TAG, "Failed to resize round to %u players", static_cast<unsigned>(count));
         return;
     }
 
+    for (uint8_t i = previous; i < count; ++i)
+    {
+        ensureName(i);
+    }
+
     state.playerCount = count;
+    undo.clear(); // Edits may name players that are gone
+    rebuildAggregates();
     roundSaved = false;
     saveState();
     requestCanvasRefresh();
@@ -780,7 +1747,16 @@ void GolfScoreApp::setPlayerCount(uint8_t count)
 
 void GolfScoreApp::toggleHoleCount()
 {
-    uint8_t next = state.holeCount == 18 ? 9 : 18;
+    // Step through the standard layouts, wrapping back to nine holes
+    uint8_t next = StandardHoleCounts[0];
+    for (uint8_t count : StandardHoleCounts)
+    {
+        if (count > state.holeCount)
+        {
+            next = count;
+            break;
+        }
+    }
     setHoleCount(next);
 }
 
@@ -800,7 +1776,15 @@ void GolfScoreApp::setHoleCount(uint8_t count)
         return;
     }
 
+    if (!round.resize(round.playerCount(), count))
+    {
+        FURI_LOG_E(TAG, "Failed to resize round to %u holes", static_cast<unsigned>(count));
+        return;
+    }
+
     state.holeCount = count;
+    undo.clear(); // Edits may name holes that are gone
+    rebuildAggregates();
     roundSaved = false;
     saveState();
     requestCanvasRefresh();
@@ -808,17 +1792,17 @@ void GolfScoreApp::setHoleCount(uint8_t count)
 
 void GolfScoreApp::setPlayerName(uint8_t index, const char *name)
 {
-    if (index >= MaxPlayers)
+    if (index >= round.playerCount())
     {
         return;
     }
 
-    auto &target = state.playerNames[index];
-    target.fill('\0');
+    char *target = round.name(index);
+    memset(target, 0, MaxNameLength);
 
     if (name && name[0] != '\0')
     {
-        snprintf(target.data(), target.size(), "%s", name);
+        snprintf(target, MaxNameLength, "%s", name);
     }
 
     ensureName(index);
@@ -828,7 +1812,7 @@ void GolfScoreApp::setPlayerName(uint8_t index, const char *name)
 
 void GolfScoreApp::setPar(uint8_t hole, uint8_t value)
 {
-    if (hole >= MaxHoles)
+    if (hole >= round.holeCount())
     {
         return;
     }
@@ -836,126 +1820,108 @@ void GolfScoreApp::setPar(uint8_t hole, uint8_t value)
     int clamped = std::clamp<int>(static_cast<int>(value), static_cast<int>(GolfScoreMinPar), static_cast<int>(GolfScoreMaxPar));
     uint8_t par_value = static_cast<uint8_t>(clamped);
 
-    if (state.par[hole] == par_value)
+    if (round.getPar(hole) == par_value)
     {
         return;
     }
 
-    state.par[hole] = par_value;
+    round.setPar(hole, par_value);
+    rebuildAggregates();
     roundSaved = false;
     saveState();
     requestCanvasRefresh();
 }
 
-bool GolfScoreApp::saveCoursePreset(uint8_t index, const char *name)
+uint16_t GolfScoreApp::saveCourse(uint16_t id, const char *name)
 {
-    if (index >= GolfScoreMaxCourses)
-    {
-        return false;
-    }
-
-    auto &preset = state.courses[index];
-    preset.holeCount = std::clamp<uint8_t>(state.holeCount, 1, MaxHoles);
-    preset.par = state.par;
-    preset.name.fill('\0');
+    GolfScoreCourse course;
+    course.id = id;
+    course.holeCount = round.holeCount();
+    memcpy(course.par.data(), round.parData(), round.parBytes());
+    memcpy(course.strokeIndex.data(), round.strokeIndexData(), round.strokeIndexBytes());
 
     if (name && name[0] != '\0')
     {
-        snprintf(preset.name.data(), preset.name.size(), "%s", name);
+        snprintf(course.name.data(), course.name.size(), "%s", name);
     }
     else
     {
-        snprintf(preset.name.data(), preset.name.size(), "Course %u", static_cast<unsigned>(index + 1));
+        snprintf(course.name.data(), course.name.size(), "Course %lu", static_cast<unsigned long>(courses.count() + 1));
     }
 
-    state.activeCourse = index;
-    saveState();
-    return true;
-}
-
-bool GolfScoreApp::deleteCoursePreset(uint8_t index)
-{
-    if (index >= GolfScoreMaxCourses)
+    // Saving under an existing name updates that course
+    GolfScoreCourseEntry existing;
+    if (course.id == InvalidCourseId && courses.findByName(course.name.data(), existing))
     {
-        return false;
+        course.id = existing.id;
     }
 
-    auto &preset = state.courses[index];
-    preset.holeCount = 0;
-    preset.par.fill(0);
-    preset.name.fill('\0');
-
-    if (state.activeCourse == index)
+    uint16_t saved = courses.save(course);
+    if (saved == InvalidCourseId)
     {
-        state.activeCourse = InvalidCourseIndex;
+        return InvalidCourseId;
     }
 
+    state.activeCourse = saved;
+    state.activeCourseName = course.name;
     saveState();
-    return true;
+    return saved;
 }
 
-void GolfScoreApp::applyCoursePreset(uint8_t index)
+bool GolfScoreApp::deleteCourse(uint16_t id)
 {
-    if (!courseSlotInUse(index))
+    if (!courses.remove(id))
     {
-        return;
+        return false;
     }
 
-    const auto &preset = state.courses[index];
-    state.holeCount = std::clamp<uint8_t>(preset.holeCount, 1, MaxHoles);
-    state.par = preset.par;
-    state.activeCourse = index;
-    resetScores();
+    if (state.activeCourse == id)
+    {
+        state.activeCourse = InvalidCourseId;
+        state.activeCourseName.fill('\0');
+    }
+
+    saveState();
+    return true;
 }
 
-bool GolfScoreApp::courseSlotInUse(uint8_t index) const
+bool GolfScoreApp::applyCourse(uint16_t id)
 {
-    if (index >= GolfScoreMaxCourses)
+    GolfScoreCourse course;
+    if (!courses.load(id, course))
     {
         return false;
     }
 
-    const auto &preset = state.courses[index];
-    return preset.holeCount >= 1 && preset.holeCount <= MaxHoles;
-}
-
-const char *GolfScoreApp::getCourseName(uint8_t index) const
-{
-    if (!courseSlotInUse(index))
+    if (!round.resize(round.playerCount(), course.holeCount))
     {
-        static const char empty[] = "";
-        return empty;
+        return false;
     }
-    return state.courses[index].name.data();
-}
 
-uint8_t GolfScoreApp::getCourseHoleCount(uint8_t index) const
-{
-    if (!courseSlotInUse(index))
+    state.holeCount = course.holeCount;
+    for (uint8_t hole = 0; hole < course.holeCount; ++hole)
     {
-        return 0;
+        uint8_t par = course.par[hole];
+        round.setPar(hole, (par < GolfScoreMinPar || par > GolfScoreMaxPar) ? GolfScoreDefaultPar : par);
+        round.setStrokeIndex(hole, course.strokeIndex[hole]);
     }
-    return state.courses[index].holeCount;
+    // Courses saved without stroke indices rank the holes in order
+    round.rankStrokeIndices();
+    round.rebuildAllowances();
+    state.activeCourse = course.id;
+    state.activeCourseName = course.name;
+    resetScores();
+    return true;
 }
 
-uint8_t GolfScoreApp::getActiveCourseIndex() const
+const char *GolfScoreApp::getActiveCourseName() const
 {
-    return state.activeCourse;
+    return state.activeCourse == InvalidCourseId ? "" : state.activeCourseName.data();
 }
 
 bool GolfScoreApp::isRoundComplete() const
 {
-    for (uint8_t player = 0; player < state.playerCount; ++player)
-    {
-        for (uint8_t hole = 0; hole < state.holeCount; ++hole)
-        {
-            if (state.strokes[player][hole] == 0)
-            {
-                return false;
-            }
-        }
-    }
-    return true;
+    return round.kernels().isComplete(round);
 }
 
 bool GolfScoreApp::finishRound()
@@ -971,57 +1937,80 @@ bool GolfScoreApp::finishRound()
     }
 
     roundSaved = true;
+    buildRoundSummary();
+    summaryPending = true;
+
+    resetScores();
+
+    if (viewDispatcher)
+    {
+        view_dispatcher_send_custom_event(viewDispatcher, RoundSummaryEventId);
+    }
+
+    return true;
+}
+
+void GolfScoreApp::buildRoundSummary()
+{
+    uint8_t players = round.playerCount();
 
-    char course_name[GolfScoreCourseNameLength];
-    if (state.activeCourse != InvalidCourseIndex && courseSlotInUse(state.activeCourse))
+    roundSummary = GolfScoreRoundSummary{};
+    if (state.activeCourse != InvalidCourseId)
     {
-        sanitize_csv_field(state.courses[state.activeCourse].name.data(), course_name, sizeof(course_name));
+        snprintf(roundSummary.course.data(), roundSummary.course.size(), "%s", state.activeCourseName.data());
     }
     else
     {
-        snprintf(course_name, sizeof(course_name), "Custom");
+        snprintf(roundSummary.course.data(), roundSummary.course.size(), "Custom");
     }
-
-    summaryBuffer.fill('\0');
-    size_t offset = snprintf(summaryBuffer.data(), summaryBuffer.size(), "Course %s (%u holes)\n", course_name, static_cast<unsigned>(state.holeCount));
-
-    for (uint8_t i = 0; i < state.playerCount && offset < summaryBuffer.size(); ++i)
+    roundSummary.holeCount = state.holeCount;
+    roundSummary.coursePar = getCoursePar();
+    roundSummary.results = std::make_unique<GolfScoreRoundResult[]>(players);
+    if (!roundSummary.results)
     {
-        const char *name = getPlayerName(i);
-        uint16_t total = getTotalScore(i);
-        int16_t rel = getRelativeToPar(i);
-        char relation[8];
-
-        if (rel == 0)
-        {
-            snprintf(relation, sizeof(relation), "E");
-        }
-        else if (rel > 0)
-        {
-            snprintf(relation, sizeof(relation), "+%d", rel);
-        }
-        else
+        return;
+    }
+    roundSummary.playerCount = players;
+
+    for (uint8_t i = 0; i < players; ++i)
+    {
+        const GolfScorePlayerAggregate &aggregate = round.aggregate(i);
+        GolfScoreRoundResult &result = roundSummary.results[i];
+        snprintf(result.name.data(), result.name.size(), "%s", round.name(i));
+        result.total = aggregate.total;
+        result.relative = getRelativeToPar(i);
+        result.front = aggregate.front;
+        result.back = aggregate.back;
+        result.bestHole = aggregate.bestHole;
+        result.putts = aggregate.putts;
+        result.penalties = aggregate.penalties;
+        result.fairwaysHit = aggregate.fairwaysHit;
+        result.fairwaysTracked = aggregate.fairwaysTracked;
+        result.greens = aggregate.greens;
+        result.handicap = round.getHandicap(i);
+        result.netRelative = getNetRelativeToPar(i);
+        if (aggregate.bestHole < state.holeCount)
         {
-            snprintf(relation, sizeof(relation), "%d", rel);
+            result.bestRelative = static_cast<int8_t>(round.getStrokes(i, aggregate.bestHole) - getPar(aggregate.bestHole));
         }
-
-        offset += snprintf(summaryBuffer.data() + offset, summaryBuffer.size() - offset, "%s %u (%s)\n", name, static_cast<unsigned>(total), relation);
     }
 
-    summaryPending = true;
-
-    resetScores();
-
-    if (viewDispatcher)
+    // Players keep entry order within a tie; tied totals share a rank
+    GolfScoreRoundResult *begin = roundSummary.results.get();
+    std::stable_sort(begin, begin + players, [](const GolfScoreRoundResult &a, const GolfScoreRoundResult &b)
+                     { return a.total < b.total; });
+    for (uint8_t i = 0; i < players; ++i)
     {
-        view_dispatcher_send_custom_event(viewDispatcher, RoundSummaryEventId);
+        bool tied = i > 0 && begin[i].total == begin[i - 1].total;
+        begin[i].rank = tied ? begin[i - 1].rank : static_cast<uint8_t>(i + 1);
     }
-
-    return true;
 }
 
 bool GolfScoreApp::exportRoundHistory() const
 {
+    GOLF_SCORE_MEMORY_PROBE("export");
+    GOLF_SCORE_TRACE_SCOPE("exportRoundHistory");
+    GolfScoreLatencyScope timing(GolfScoreLatencyHistoryAppend);
     Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
     if (!storage)
     {
@@ -1036,7 +2025,14 @@ bool GolfScoreApp::exportRoundHistory() const
     }
 
     char path[256];
-    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, HistoryFileName);
+    roundHistoryPath(path, sizeof(path));
+
+    FuriString *header = furi_string_alloc();
+    round_history_header(header);
+    if (!widen_round_history(storage, path, header))
+    {
+        FURI_LOG_E(TAG, "Failed to widen round history to %u holes", static_cast<unsigned>(MaxHoles));
+    }
 
     bool result = false;
     if (storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_APPEND))
@@ -1044,15 +2040,7 @@ bool GolfScoreApp::exportRoundHistory() const
         uint64_t existing_size = storage_file_size(file);
         if (existing_size == 0)
         {
-            FuriString *header = furi_string_alloc();
-            furi_string_printf(header, "Date,Time,Course,HoleCount,Player,Total,Relative");
-            for (uint8_t hole = 0; hole < MaxHoles; ++hole)
-            {
-                furi_string_cat_printf(header, ",H%u", static_cast<unsigned>(hole + 1));
-            }
-            furi_string_cat_str(header, "\r\n");
-            storage_file_write(file, furi_string_get_cstr(header), furi_string_size(header));
-            furi_string_free(header);
+            golf_score_file_write(file, furi_string_get_cstr(header), furi_string_size(header));
         }
 
         DateTime datetime;
@@ -1064,37 +2052,27 @@ bool GolfScoreApp::exportRoundHistory() const
         snprintf(time_buf, sizeof(time_buf), "%02u:%02u", datetime.hour, datetime.minute);
 
         char course_name[GolfScoreCourseNameLength];
-        if (state.activeCourse != InvalidCourseIndex && courseSlotInUse(state.activeCourse))
+        if (state.activeCourse != InvalidCourseId)
         {
-            sanitize_csv_field(state.courses[state.activeCourse].name.data(), course_name, sizeof(course_name));
+            sanitize_csv_field(state.activeCourseName.data(), course_name, sizeof(course_name));
         }
         else
         {
             snprintf(course_name, sizeof(course_name), "Custom");
         }
 
-        for (uint8_t i = 0; i < state.playerCount; ++i)
+        for (uint8_t i = 0; i < round.playerCount(); ++i)
         {
             char player_name[GolfScoreMaxNameLength];
             sanitize_csv_field(getPlayerName(i), player_name, sizeof(player_name));
+            if (player_name[0] == GolfScoreHistoryTeamMarker)
+            {
+                player_name[0] = ' ';
+            }
 
             uint16_t total = getTotalScore(i);
-            uint8_t holes_played = getPlayedHoleCount(i);
-            int16_t rel = getRelativeToPar(i);
-
             char relation[8];
-            if (holes_played == 0)
-            {
-                snprintf(relation, sizeof(relation), "--");
-            }
-            else if (rel > 0)
-            {
-                snprintf(relation, sizeof(relation), "+%d", rel);
-            }
-            else
-            {
-                snprintf(relation, sizeof(relation), "%d", rel);
-            }
+            format_relation(getPlayedHoleCount(i) > 0, getRelativeToPar(i), relation, sizeof(relation));
 
             FuriString *row = furi_string_alloc();
             furi_string_printf(row,
@@ -1107,30 +2085,27 @@ bool GolfScoreApp::exportRoundHistory() const
                                static_cast<unsigned>(total),
                                relation);
 
-            for (uint8_t hole = 0; hole < MaxHoles; ++hole)
+            for (uint8_t hole = 0; hole < round.holeCount(); ++hole)
             {
-                if (hole < state.holeCount)
+                uint8_t strokes = round.getStrokes(i, hole);
+                if (strokes > 0)
                 {
-                    uint8_t strokes = state.strokes[i][hole];
-                    if (strokes > 0)
-                    {
-                        furi_string_cat_printf(row, ",%u", static_cast<unsigned>(strokes));
-                    }
-                    else
-                    {
-                        furi_string_cat_str(row, ",");
-                    }
+                    furi_string_cat_printf(row, ",%u", static_cast<unsigned>(strokes));
                 }
                 else
                 {
                     furi_string_cat_str(row, ",");
                 }
             }
+            for (uint8_t hole = round.holeCount(); hole < MaxHoles; ++hole)
+            {
+                furi_string_cat_str(row, ",");
+            }
 
             furi_string_cat_str(row, "\r\n");
 
             size_t row_size = furi_string_size(row);
-            if (storage_file_write(file, furi_string_get_cstr(row), row_size) != row_size)
+            if (golf_score_file_write(file, furi_string_get_cstr(row), row_size) != row_size)
             {
                 furi_string_free(row);
                 result = false;
@@ -1141,9 +2116,58 @@ bool GolfScoreApp::exportRoundHistory() const
             result = true;
         }
 
+        // Team rows after the players, net per hole, Player field "*Team A"
+        for (uint8_t team = 0; result && teams.active() && team < teams.count(); ++team)
+        {
+            const GolfScoreTeamTotal &total = teams.total(team);
+            if (total.members == 0)
+            {
+                continue;
+            }
+
+            char relation[8];
+            format_relation(total.parPlayed > 0, teams.relative(team), relation, sizeof(relation));
+
+            FuriString *row = furi_string_alloc();
+            furi_string_printf(row,
+                               "%s,%s,%s,%u,%cTeam %c,%d,%s",
+                               date_buf,
+                               time_buf,
+                               course_name,
+                               static_cast<unsigned>(state.holeCount),
+                               GolfScoreHistoryTeamMarker,
+                               GolfScoreTeams::letter(team),
+                               total.total,
+                               relation);
+
+            for (uint8_t hole = 0; hole < round.holeCount(); ++hole)
+            {
+                GolfScoreTeamHole value = teams.hole(round, team, hole);
+                if (value.scored > 0)
+                {
+                    furi_string_cat_printf(row, ",%d", value.value);
+                }
+                else
+                {
+                    furi_string_cat_str(row, ",");
+                }
+            }
+            for (uint8_t hole = round.holeCount(); hole < MaxHoles; ++hole)
+            {
+                furi_string_cat_str(row, ",");
+            }
+
+            furi_string_cat_str(row, "\r\n");
+
+            size_t row_size = furi_string_size(row);
+            result = golf_score_file_write(file, furi_string_get_cstr(row), row_size) == row_size;
+            furi_string_free(row);
+        }
+
         storage_file_close(file);
     }
 
+    furi_string_free(header);
     storage_file_free(file);
     furi_record_close(RECORD_STORAGE);
     return result;
@@ -1158,7 +2182,7 @@ bool GolfScoreApp::clearRoundHistory() const
     }
 
     char path[256];
-    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, HistoryFileName);
+    roundHistoryPath(path, sizeof(path));
     bool result = storage_common_remove(storage, path);
 
     if (!result)
@@ -1179,47 +2203,9 @@ bool GolfScoreApp::clearRoundHistory() const
     return result;
 }
 
-bool GolfScoreApp::readRoundHistory(FuriString *out) const
+void GolfScoreApp::roundHistoryPath(char *path, size_t size)
 {
-    if (!out)
-    {
-        return false;
-    }
-
-    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
-    if (!storage)
-    {
-        return false;
-    }
-
-    File *file = storage_file_alloc(storage);
-    if (!file)
-    {
-        furi_record_close(RECORD_STORAGE);
-        return false;
-    }
-
-    char path[256];
-    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, HistoryFileName);
-
-    bool result = false;
-    if (storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING))
-    {
-        furi_string_reset(out);
-        char buffer[129];
-        size_t read = 0;
-        while ((read = storage_file_read(file, buffer, sizeof(buffer) - 1)) > 0)
-        {
-            buffer[read] = '\0';
-            furi_string_cat_str(out, buffer);
-        }
-        result = furi_string_size(out) > 0;
-        storage_file_close(file);
-    }
-
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
-    return result;
+    snprintf(path, size, STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, HistoryFileName);
 }
 
 void GolfScoreApp::requestCanvasRefresh()
@@ -1,12 +1,19 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
 #include "font/font.h"
 #include "easy_flipper/easy_flipper.h"
 #include "golf_score_config.hpp"
+#include "round/round.hpp"
+#include "courses/course_db.hpp"
+#include "summary/summary.hpp"
+#include "scoring/scoring.hpp"
+#include "teams/teams.hpp"
+#include "undo/undo.hpp"
 
 struct FuriString;
 
@@ -33,11 +40,14 @@ typedef enum
     GolfScoreViewCourseList = 6,
     GolfScoreViewSplash = 7,
     GolfScoreViewHistory = 8,
+    GolfScoreViewHistoryDetail = 9,
+    GolfScoreViewSummary = 10,
 } GolfScoreView;
 
 class GolfScoreScorecard;
 class GolfScoreSettings;
 class GolfScoreAbout;
+class GolfScoreSummary;
 
 class GolfScoreApp
 {
@@ -47,57 +57,82 @@ public:
     static constexpr size_t MaxNameLength = GolfScoreMaxNameLength;
 
 private:
-    struct CoursePreset
-    {
-        uint8_t holeCount = 0;
-        std::array<uint8_t, MaxHoles> par{};
-        std::array<char, GolfScoreCourseNameLength> name{};
-    };
-
+    // Fixed part of state.bin. The file continues with the pars, the stroke
+    // indices, the player names, the handicaps, the team ids and the
+    // hole-major hole entries, sized by holeCount and playerCount. Hole edits after the snapshot go to state.journal.
     struct PersistentState
     {
         uint8_t version = 0;
         uint8_t playerCount = 1;
         uint8_t holeCount = 9;
-        uint8_t reserved = 0;
-        std::array<std::array<char, MaxNameLength>, MaxPlayers> playerNames{};
-        std::array<std::array<uint8_t, MaxHoles>, MaxPlayers> strokes{};
-        std::array<uint8_t, MaxHoles> par{};
-        std::array<CoursePreset, GolfScoreMaxCourses> courses{};
-        uint8_t activeCourse = 0xFF;
+        uint8_t generation = 0; // Journal generation that belongs to this snapshot
+        uint16_t activeCourse = 0xFFFF;                                // Course library id the pars came from
+        std::array<char, GolfScoreCourseNameLength> activeCourseName{}; // Its name, kept for display
+        uint8_t format = GolfScoreFormatStroke;                        // GolfScoreFormatId
+        uint8_t teamMode = GolfScoreTeamsOff;                          // GolfScoreTeamMode
     };
+    // Written as is, so any padding or reordering changes the file; see host_format_test
+    static_assert(sizeof(PersistentState) == 24, "state.bin header layout changed");
+    static_assert(offsetof(PersistentState, activeCourse) == 4 && offsetof(PersistentState, activeCourseName) == 6 &&
+                      offsetof(PersistentState, format) == 22 && offsetof(PersistentState, teamMode) == 23,
+                  "state.bin header layout changed");
+
+    struct LegacyCourses; // Presets stored inline by state versions 2 and 3
 
     std::unique_ptr<GolfScoreAbout> about;          // About view instance
     std::unique_ptr<GolfScoreScorecard> scorecard;  // Scorecard view instance
     std::unique_ptr<GolfScoreSettings> settings;    // Settings view instance
+    std::unique_ptr<GolfScoreSummary> summary;      // Round summary view instance
     Submenu *submenu = nullptr;                   // Application submenu
     FuriTimer *timer = nullptr;                   // Viewport refresh timer
     View *splashView = nullptr;                   // Splash screen view
-    FuriTimer *splashTimer = nullptr;             // Splash screen timer
+    std::unique_ptr<uint8_t[]> splashBitmap;      // Splash decoded once from its packed form
     bool splashFinished = false;                  // Splash shown flag
-    PersistentState state{};                      // Persisted round data
+    bool stateLoaded = false;                     // loadState() has completed
+    uint32_t constructedTick = 0;                 // Tick at constructor entry, for time-to-interactive
+    PersistentState state{};                      // Persisted round settings
+    GolfScoreRound round;                         // Players, strokes and running totals
+    GolfScoreCourseDb courses;                    // On-disk course library
+    std::unique_ptr<GolfScoreFormat> format;      // Live standings for state.format
+    GolfScoreTeams teams;                         // Team totals for state.teamMode
+    GolfScoreUndoRing undo;                       // Recent hole edits, kept in state.journal
     bool roundSaved = false;                      // Tracks if current round already saved
-    std::array<char, 160> summaryBuffer{};
+    GolfScoreRoundSummary roundSummary{};         // Results of the last finished round
     bool summaryPending = false;
+    uint8_t journalGeneration = 0;                // Generation of the snapshot on disk
+    uint16_t journalEntries = 0;                  // Journal records appended since that snapshot
 
     static uint32_t callbackExitApp(void *context);
     void callbackSubmenuChoices(uint32_t index);
     void createAppDataPath();
     static void submenuChoicesCallback(void *context, uint32_t index);
     static void timerCallback(void *context);
-    static void splashTimerCallback(void *context);
-    static void splashDraw(Canvas *canvas, void *context);
+    static void splashDraw(Canvas *canvas, void *model);
+    static bool splashInput(InputEvent *event, void *context);
     static bool splashEventCallback(void *context, uint32_t event);
     void dismissSplash();
     void applyDefaults();
     void loadState();
-    void saveState() const;
+    void saveState();
+    bool resetJournal();
+    void journalEntry(uint8_t kind, const GolfScoreEditOp &op);
+    uint16_t replayJournal();
     void ensureName(uint8_t index);
-    bool writeStateToFile(const PersistentState &data) const;
-    bool readStateFromFile(PersistentState &data) const;
+    bool writeStateToFile(const PersistentState &data, const GolfScoreRound &players) const;
+    bool readStateFromFile(PersistentState &data, GolfScoreRound &players, LegacyCourses &legacy) const;
+    void importLegacyCourses(const LegacyCourses &legacy);
+    void rebuildAggregates();
+    void rebuildAggregate(uint8_t player);
+    bool applyEntry(uint8_t player, uint8_t hole, GolfScoreHoleEntry entry);
+    void recordEdit(uint8_t player, uint8_t hole, GolfScoreHoleEntry entry);
+    void buildRoundSummary();
+
+#ifdef GOLF_SCORE_HOST
+    friend struct GolfScoreHostAccess; // Host benchmarks and tests reach the save path directly
+#endif
 
 public:
-    static constexpr uint8_t InvalidCourseIndex = 0xFF;
+    static constexpr uint16_t InvalidCourseId = GolfScoreCourseDb::InvalidId;
 
     GolfScoreApp();
     ~GolfScoreApp();
@@ -111,7 +146,7 @@ public:
     static void viewPortInput(InputEvent *event, void *context);
 
     uint8_t getHoleCount() const noexcept { return state.holeCount; }
-    uint8_t getPlayerCount() const noexcept { return state.playerCount; }
+    uint8_t getPlayerCount() const noexcept { return round.playerCount(); }
     const char *getPlayerName(uint8_t index) const;
     uint8_t getScore(uint8_t player, uint8_t hole) const;
     uint16_t getTotalScore(uint8_t player) const;
@@ -119,27 +154,45 @@ public:
     uint8_t getPar(uint8_t hole) const;
     uint16_t getCoursePar() const;
     uint8_t getPlayedHoleCount(uint8_t player) const;
+    int16_t getNetTotal(uint8_t player) const;
+    int16_t getNetRelativeToPar(uint8_t player) const;
+    int8_t getHandicap(uint8_t player) const;
+    void setHandicap(uint8_t player, int8_t handicap);
+    uint8_t getStrokeIndex(uint8_t hole) const;
+    void setStrokeIndex(uint8_t hole, uint8_t strokeIndex);
 
     void adjustScore(uint8_t player, uint8_t hole, int8_t delta);
+    void adjustStat(uint8_t player, uint8_t hole, GolfScoreHoleStat stat, int8_t delta);
+    // Step back or forward through recent hole edits; report the hole changed
+    bool undoEdit(uint8_t &player, uint8_t &hole);
+    bool redoEdit(uint8_t &player, uint8_t &hole);
+    GolfScoreHoleEntry getHoleEntry(uint8_t player, uint8_t hole) const;
+    const GolfScorePlayerAggregate *getAggregate(uint8_t player) const;
     void resetScores();
+    GolfScoreFormatId getFormat() const noexcept { return static_cast<GolfScoreFormatId>(state.format); }
+    void setFormat(GolfScoreFormatId id);
+    void getStanding(uint8_t player, char *out, size_t size) const;
+    GolfScoreTeamMode getTeamMode() const noexcept { return static_cast<GolfScoreTeamMode>(state.teamMode); }
+    void setTeamMode(GolfScoreTeamMode mode);
+    uint8_t getTeam(uint8_t player) const;
+    void setTeam(uint8_t player, uint8_t team);
+    const GolfScoreTeams &getTeams() const noexcept { return teams; }
     void cyclePlayerCount();
     void setPlayerCount(uint8_t count);
     void toggleHoleCount();
     void setHoleCount(uint8_t count);
     void setPlayerName(uint8_t index, const char *name);
     void setPar(uint8_t hole, uint8_t value);
-    bool saveCoursePreset(uint8_t index, const char *name);
-    bool deleteCoursePreset(uint8_t index);
-    void applyCoursePreset(uint8_t index);
-    bool courseSlotInUse(uint8_t index) const;
-    const char *getCourseName(uint8_t index) const;
-    uint8_t getCourseHoleCount(uint8_t index) const;
-    uint8_t getActiveCourseIndex() const;
+    uint16_t saveCourse(uint16_t id, const char *name);
+    bool deleteCourse(uint16_t id);
+    bool applyCourse(uint16_t id);
+    uint16_t getActiveCourseId() const { return state.activeCourse; }
+    const char *getActiveCourseName() const;
     bool isRoundComplete() const;
     bool isRoundSaved() const { return roundSaved; }
     bool finishRound();
     bool exportRoundHistory() const;
     bool clearRoundHistory() const;
-    bool readRoundHistory(FuriString *out) const;
+    static void roundHistoryPath(char *path, size_t size);
     void requestCanvasRefresh();
 };
@@ -0,0 +1,843 @@
+#include "courses/course_db.hpp"
+#include "app.hpp"
+#include "debug/perf_counters.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    constexpr uint32_t CourseDbMagic = 0x44435347; // "GSCD"
+    constexpr uint16_t CourseDbVersion = 2;
+    constexpr uint32_t CourseIndexMagic = 0x49435347; // "GSCI"
+    constexpr uint8_t CourseIndexVersion = 2;          // 1 was a flat sorted array without a header
+    constexpr const char *CourseDbFileName = "courses.db";
+    constexpr const char *CourseIndexFileName = "courses.idx";
+    constexpr uint32_t MoveChunkEntries = 8;
+}
+
+static_assert(sizeof(GolfScoreCourseEntry) == 20, "courses.idx entry layout changed");
+
+GolfScoreCourseDb::Session::Session(bool write)
+{
+    storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage || !open(write) || indexReady())
+    {
+        return;
+    }
+
+    // courses.idx does not match the records: an update was cut short or the
+    // index predates blocks. Rebuild it, reopening for writing if need be.
+    if (!write)
+    {
+        closeFiles();
+        if (!open(true))
+        {
+            return;
+        }
+    }
+    if (!rebuildIndex())
+    {
+        FURI_LOG_E(TAG, "Failed to rebuild %s", CourseIndexFileName);
+        closeFiles();
+    }
+}
+
+GolfScoreCourseDb::Session::~Session()
+{
+    closeFiles();
+    if (storage)
+    {
+        furi_record_close(RECORD_STORAGE);
+    }
+}
+
+bool GolfScoreCourseDb::Session::open(bool write)
+{
+    FS_AccessMode access = write ? FSAM_READ_WRITE : FSAM_READ;
+    FS_OpenMode mode = write ? FSOM_OPEN_ALWAYS : FSOM_OPEN_EXISTING;
+
+    char filePath[256];
+    db = storage_file_alloc(storage);
+    path(filePath, sizeof(filePath), CourseDbFileName);
+    if (db && !storage_file_open(db, filePath, access, mode))
+    {
+        storage_file_free(db);
+        db = nullptr;
+    }
+
+    index = storage_file_alloc(storage);
+    path(filePath, sizeof(filePath), CourseIndexFileName);
+    if (index && !storage_file_open(index, filePath, access, mode))
+    {
+        storage_file_free(index);
+        index = nullptr;
+    }
+
+    if (!ok())
+    {
+        closeFiles();
+        return false;
+    }
+
+    if (storage_file_read(db, &header, sizeof(Header)) != sizeof(Header) || header.magic != CourseDbMagic || header.version != CourseDbVersion)
+    {
+        // New or unreadable library: start empty
+        header = Header{CourseDbMagic, CourseDbVersion, InvalidId, 0, 0, sizeof(Header)};
+        if (write)
+        {
+            storage_file_seek(index, 0, true);
+            storage_file_truncate(index);
+            storage_file_seek(db, 0, true);
+            storage_file_truncate(db);
+            writeHeader();
+        }
+    }
+    return true;
+}
+
+void GolfScoreCourseDb::Session::closeFiles()
+{
+    if (db)
+    {
+        storage_file_close(db);
+        storage_file_free(db);
+        db = nullptr;
+    }
+
+    if (index)
+    {
+        storage_file_close(index);
+        storage_file_free(index);
+        index = nullptr;
+    }
+}
+
+// Reads the index header and directory and checks them against the records
+bool GolfScoreCourseDb::Session::indexReady()
+{
+    indexHeader = IndexHeader{CourseIndexMagic, CourseIndexVersion, 0, 0, 0};
+    blocks.fill(IndexBlock{});
+    entries = 0;
+    if (header.flags & HeaderIndexPending)
+    {
+        return false;
+    }
+
+    // An empty library may not have written its index yet
+    if (storage_file_size(index) == 0)
+    {
+        return header.liveCount == 0;
+    }
+
+    if (!storage_file_seek(index, 0, true) ||
+        storage_file_read(index, &indexHeader, sizeof(IndexHeader)) != sizeof(IndexHeader) ||
+        storage_file_read(index, blocks.data(), sizeof(blocks)) != sizeof(blocks) ||
+        indexHeader.magic != CourseIndexMagic || indexHeader.version != CourseIndexVersion ||
+        indexHeader.used > MaxIndexBlocks || indexHeader.blockCount > MaxIndexBlocks)
+    {
+        return false;
+    }
+
+    uint32_t seen[MaxIndexBlocks / 32] = {};
+    for (size_t slot = 0; slot < indexHeader.used; ++slot)
+    {
+        const IndexBlock &block = blocks[slot];
+        if (block.block >= indexHeader.blockCount || block.fill == 0 || block.fill > IndexBlockEntries ||
+            (seen[block.block / 32] & (1u << (block.block % 32))))
+        {
+            return false;
+        }
+        seen[block.block / 32] |= 1u << (block.block % 32);
+        entries += block.fill;
+    }
+    return entries == header.liveCount && storage_file_size(index) >= entryOffset(indexHeader.blockCount, 0);
+}
+
+bool GolfScoreCourseDb::Session::rebuildIndex()
+{
+    indexHeader = IndexHeader{CourseIndexMagic, CourseIndexVersion, 0, 0, 0};
+    blocks.fill(IndexBlock{});
+    entries = 0;
+    if (!beginIndexUpdate() || !storage_file_seek(index, 0, true) || !storage_file_truncate(index) || !writeIndexHeader())
+    {
+        return false;
+    }
+
+    // Walk the records in file order; each one's size gives the next offset
+    uint16_t live = 0;
+    uint32_t offset = sizeof(Header);
+    RecordHeader record;
+    while (offset + sizeof(RecordHeader) <= header.end && readRecord(db, static_cast<uint16_t>(offset / RecordAlign), record) &&
+           record.capacity % RecordAlign == 0)
+    {
+        if (record.inUse && record.holeCount >= 1 && record.holeCount <= GolfScoreMaxHoles && payloadBytes(record) <= record.capacity &&
+            live < GolfScoreMaxCourses)
+        {
+            GolfScoreCourseEntry entry;
+            entry.name = record.name;
+            entry.name.back() = '\0';
+            entry.id = static_cast<uint16_t>(offset / RecordAlign);
+            entry.holeCount = record.holeCount;
+            if (!insertEntry(entry))
+            {
+                return false;
+            }
+            ++live;
+        }
+        offset += sizeof(RecordHeader) + record.capacity;
+    }
+
+    header.liveCount = live;
+    return endIndexUpdate();
+}
+
+bool GolfScoreCourseDb::Session::writeHeader()
+{
+    return storage_file_seek(db, 0, true) && golf_score_file_write(db, &header, sizeof(Header)) == sizeof(Header);
+}
+
+bool GolfScoreCourseDb::Session::writeIndexHeader()
+{
+    return storage_file_seek(index, 0, true) &&
+           golf_score_file_write(index, &indexHeader, sizeof(IndexHeader)) == sizeof(IndexHeader) &&
+           golf_score_file_write(index, blocks.data(), sizeof(blocks)) == sizeof(blocks);
+}
+
+bool GolfScoreCourseDb::Session::beginIndexUpdate()
+{
+    header.flags |= HeaderIndexPending;
+    return writeHeader();
+}
+
+bool GolfScoreCourseDb::Session::endIndexUpdate()
+{
+    header.flags &= static_cast<uint16_t>(~HeaderIndexPending);
+    return writeHeader();
+}
+
+uint32_t GolfScoreCourseDb::Session::entryOffset(uint8_t block, uint32_t slot) const
+{
+    return static_cast<uint32_t>(sizeof(IndexHeader) + sizeof(blocks) +
+                                 (static_cast<uint32_t>(block) * IndexBlockEntries + slot) * sizeof(GolfScoreCourseEntry));
+}
+
+// Directory slot holding `position`, and the position of its first entry
+bool GolfScoreCourseDb::Session::locate(uint32_t position, size_t &slot, uint32_t &first) const
+{
+    first = 0;
+    for (slot = 0; slot < indexHeader.used; ++slot)
+    {
+        if (position < first + blocks[slot].fill)
+        {
+            return true;
+        }
+        first += blocks[slot].fill;
+    }
+    return false;
+}
+
+// A block no directory slot uses, else a new one at the end of the file
+bool GolfScoreCourseDb::Session::takeBlock(uint8_t &block)
+{
+    uint32_t seen[MaxIndexBlocks / 32] = {};
+    for (size_t slot = 0; slot < indexHeader.used; ++slot)
+    {
+        seen[blocks[slot].block / 32] |= 1u << (blocks[slot].block % 32);
+    }
+    for (block = 0; block < indexHeader.blockCount; ++block)
+    {
+        if (!(seen[block / 32] & (1u << (block % 32))))
+        {
+            return true;
+        }
+    }
+
+    if (indexHeader.blockCount == MaxIndexBlocks)
+    {
+        return false;
+    }
+
+    // Grow the file by a whole block so every entry slot exists
+    if (storage_file_size(index) < entryOffset(0, 0) && !writeIndexHeader())
+    {
+        return false;
+    }
+    uint8_t zeros[MoveChunkEntries * sizeof(GolfScoreCourseEntry)] = {};
+    if (!storage_file_seek(index, entryOffset(block, 0), true))
+    {
+        return false;
+    }
+    for (uint32_t written = 0; written < IndexBlockEntries; written += MoveChunkEntries)
+    {
+        if (golf_score_file_write(index, zeros, sizeof(zeros)) != sizeof(zeros))
+        {
+            return false;
+        }
+    }
+    ++indexHeader.blockCount;
+    return true;
+}
+
+bool GolfScoreCourseDb::Session::moveEntries(uint8_t fromBlock, uint32_t from, uint8_t toBlock, uint32_t to, uint32_t count)
+{
+    // Moving up within a block copies the last chunk first
+    GolfScoreCourseEntry chunk[MoveChunkEntries];
+    bool backwards = fromBlock == toBlock && to > from;
+    uint32_t done = 0;
+    while (done < count)
+    {
+        uint32_t size = std::min(MoveChunkEntries, count - done);
+        uint32_t at = backwards ? count - done - size : done;
+        size_t bytes = size * sizeof(GolfScoreCourseEntry);
+        if (!storage_file_seek(index, entryOffset(fromBlock, from + at), true) ||
+            storage_file_read(index, chunk, bytes) != bytes ||
+            !storage_file_seek(index, entryOffset(toBlock, to + at), true) ||
+            golf_score_file_write(index, chunk, bytes) != bytes)
+        {
+            return false;
+        }
+        done += size;
+    }
+    return true;
+}
+
+void GolfScoreCourseDb::Session::dropSlot(size_t slot)
+{
+    std::copy(blocks.begin() + slot + 1, blocks.begin() + indexHeader.used, blocks.begin() + slot);
+    blocks[--indexHeader.used] = IndexBlock{};
+}
+
+// After a removal: an empty block leaves the directory, and a block that
+// fits in half a block together with a neighbour is merged into it
+bool GolfScoreCourseDb::Session::mergeAt(size_t slot)
+{
+    constexpr uint8_t half = IndexBlockEntries / 2;
+    if (blocks[slot].fill == 0)
+    {
+        dropSlot(slot);
+        return true;
+    }
+
+    if (slot > 0 && blocks[slot - 1].fill + blocks[slot].fill <= half)
+    {
+        --slot;
+    }
+    else if (slot + 1 >= indexHeader.used || blocks[slot].fill + blocks[slot + 1].fill > half)
+    {
+        return true;
+    }
+
+    // Append the later block's entries to the earlier one
+    IndexBlock &into = blocks[slot];
+    const IndexBlock &from = blocks[slot + 1];
+    if (!moveEntries(from.block, 0, into.block, into.fill, from.fill))
+    {
+        return false;
+    }
+    into.fill = static_cast<uint8_t>(into.fill + from.fill);
+    dropSlot(slot + 1);
+    return true;
+}
+
+bool GolfScoreCourseDb::Session::readEntry(uint32_t position, GolfScoreCourseEntry &out)
+{
+    size_t slot;
+    uint32_t first;
+    return locate(position, slot, first) &&
+           storage_file_seek(index, entryOffset(blocks[slot].block, position - first), true) &&
+           storage_file_read(index, &out, sizeof(GolfScoreCourseEntry)) == sizeof(GolfScoreCourseEntry);
+}
+
+uint32_t GolfScoreCourseDb::Session::lowerBound(const GolfScoreCourseEntry &key)
+{
+    uint32_t low = 0;
+    uint32_t high = entries;
+    GolfScoreCourseEntry probe;
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+        if (!readEntry(mid, probe))
+        {
+            break;
+        }
+
+        if (compare(probe, key) < 0)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+uint32_t GolfScoreCourseDb::Session::prefixBound(uint32_t low, uint32_t high, const char *prefix, size_t length, bool upper)
+{
+    GolfScoreCourseEntry probe;
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+        if (!readEntry(mid, probe))
+        {
+            break;
+        }
+
+        int result = compareNames(probe.name.data(), prefix, length);
+        if (result < 0 || (upper && result == 0))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+bool GolfScoreCourseDb::Session::insertEntry(const GolfScoreCourseEntry &entry)
+{
+    uint32_t position = lowerBound(entry);
+    if (indexHeader.used == 0)
+    {
+        uint8_t block;
+        if (!takeBlock(block))
+        {
+            return false;
+        }
+        blocks[0] = IndexBlock{block, 0};
+        indexHeader.used = 1;
+    }
+
+    // The block holding the position, or ending at it
+    size_t slot = 0;
+    uint32_t first = 0;
+    while (slot + 1 < indexHeader.used && position > first + blocks[slot].fill)
+    {
+        first += blocks[slot].fill;
+        ++slot;
+    }
+
+    if (blocks[slot].fill == IndexBlockEntries)
+    {
+        // Split: the upper half moves to a block placed after this one
+        constexpr uint8_t half = IndexBlockEntries / 2;
+        uint8_t spare;
+        if (indexHeader.used == MaxIndexBlocks || !takeBlock(spare) ||
+            !moveEntries(blocks[slot].block, half, spare, 0, IndexBlockEntries - half))
+        {
+            return false;
+        }
+        std::copy_backward(blocks.begin() + slot + 1, blocks.begin() + indexHeader.used, blocks.begin() + indexHeader.used + 1);
+        blocks[slot + 1] = IndexBlock{spare, static_cast<uint8_t>(IndexBlockEntries - half)};
+        blocks[slot].fill = half;
+        ++indexHeader.used;
+        if (position - first > half)
+        {
+            first += half;
+            ++slot;
+        }
+    }
+
+    IndexBlock &target = blocks[slot];
+    uint32_t at = position - first;
+    if (!moveEntries(target.block, at, target.block, at + 1, target.fill - at) ||
+        !storage_file_seek(index, entryOffset(target.block, at), true) ||
+        golf_score_file_write(index, &entry, sizeof(GolfScoreCourseEntry)) != sizeof(GolfScoreCourseEntry))
+    {
+        return false;
+    }
+    ++target.fill;
+    ++entries;
+    return writeIndexHeader();
+}
+
+bool GolfScoreCourseDb::Session::removeEntry(const GolfScoreCourseEntry &entry)
+{
+    uint32_t position = lowerBound(entry);
+    GolfScoreCourseEntry found;
+    size_t slot;
+    uint32_t first;
+    if (position >= entries || !readEntry(position, found) || found.id != entry.id || !locate(position, slot, first))
+    {
+        return false;
+    }
+
+    IndexBlock &target = blocks[slot];
+    uint32_t at = position - first;
+    if (!moveEntries(target.block, at + 1, target.block, at, target.fill - at - 1))
+    {
+        return false;
+    }
+    --target.fill;
+    --entries;
+    return mergeAt(slot) && writeIndexHeader();
+}
+
+void GolfScoreCourseDb::path(char *out, size_t size, const char *file)
+{
+    snprintf(out, size, STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, file);
+}
+
+uint32_t GolfScoreCourseDb::recordOffset(uint16_t id)
+{
+    return static_cast<uint32_t>(id) * RecordAlign;
+}
+
+uint8_t GolfScoreCourseDb::capacityFor(uint8_t payload)
+{
+    // Header plus payload stays a multiple of the id unit
+    return static_cast<uint8_t>((payload + RecordAlign - 1) / RecordAlign * RecordAlign);
+}
+
+uint8_t GolfScoreCourseDb::payloadBytes(const RecordHeader &record)
+{
+    return static_cast<uint8_t>(record.flags & RecordStrokeIndex ? record.holeCount * 2 : record.holeCount);
+}
+
+bool GolfScoreCourseDb::validId(const Header &header, uint16_t id)
+{
+    return id != InvalidId && recordOffset(id) >= sizeof(Header) && recordOffset(id) + sizeof(RecordHeader) <= header.end;
+}
+
+int GolfScoreCourseDb::compareNames(const char *a, const char *b, size_t length)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        int ca = std::tolower(static_cast<unsigned char>(a[i]));
+        int cb = std::tolower(static_cast<unsigned char>(b[i]));
+        if (ca != cb || ca == '\0')
+        {
+            return ca - cb;
+        }
+    }
+    return 0;
+}
+
+int GolfScoreCourseDb::compare(const GolfScoreCourseEntry &a, const GolfScoreCourseEntry &b)
+{
+    int result = compareNames(a.name.data(), b.name.data(), a.name.size());
+    if (result != 0)
+    {
+        return result;
+    }
+    return static_cast<int>(a.id) - static_cast<int>(b.id);
+}
+
+bool GolfScoreCourseDb::readRecord(File *db, uint16_t id, RecordHeader &out)
+{
+    return storage_file_seek(db, recordOffset(id), true) && storage_file_read(db, &out, sizeof(RecordHeader)) == sizeof(RecordHeader);
+}
+
+bool GolfScoreCourseDb::writeRecord(File *db, uint16_t id, const RecordHeader &record, const GolfScoreCourse *course)
+{
+    return storage_file_seek(db, recordOffset(id), true) &&
+           golf_score_file_write(db, &record, sizeof(RecordHeader)) == sizeof(RecordHeader) &&
+           (!course || golf_score_file_write(db, course->par.data(), record.holeCount) == record.holeCount) &&
+           (!course || !(record.flags & RecordStrokeIndex) ||
+            golf_score_file_write(db, course->strokeIndex.data(), record.holeCount) == record.holeCount);
+}
+
+uint16_t GolfScoreCourseDb::allocate(Session &session, uint8_t &capacity)
+{
+    // First fit from the free list; capacity returns the size of the slot found
+    // The list can be no longer than the file has record slots; a longer
+    // walk or a link outside the file means it is damaged
+    uint16_t previous = InvalidId;
+    uint16_t id = session.header.freeHead;
+    uint32_t steps = session.header.end / RecordAlign;
+    RecordHeader record;
+    while (id != InvalidId)
+    {
+        if (steps-- == 0 || !validId(session.header, id) || !readRecord(session.db, id, record) || record.inUse)
+        {
+            FURI_LOG_E(TAG, "Free list in %s is damaged, relinking", CourseDbFileName);
+            if (!relinkFree(session))
+            {
+                return InvalidId;
+            }
+            break;
+        }
+        if (!record.inUse && record.capacity >= capacity)
+        {
+            if (previous == InvalidId)
+            {
+                session.header.freeHead = record.nextFree;
+            }
+            else
+            {
+                RecordHeader link;
+                if (!readRecord(session.db, previous, link))
+                {
+                    return InvalidId;
+                }
+                link.nextFree = record.nextFree;
+                if (!writeRecord(session.db, previous, link, nullptr))
+                {
+                    return InvalidId;
+                }
+            }
+            capacity = record.capacity;
+            return id;
+        }
+        previous = id;
+        id = record.nextFree;
+    }
+
+    // Otherwise append, as long as the offset still fits an id
+    uint32_t size = sizeof(RecordHeader) + capacity;
+    if ((session.header.end + size) / RecordAlign >= InvalidId)
+    {
+        return InvalidId;
+    }
+    id = static_cast<uint16_t>(session.header.end / RecordAlign);
+    session.header.end += size;
+    return id;
+}
+
+// Links every free record again in file order, walking the records as the
+// index rebuild does. The caller writes the header.
+bool GolfScoreCourseDb::relinkFree(Session &session)
+{
+    session.header.freeHead = InvalidId;
+    uint32_t offset = sizeof(Header);
+    RecordHeader record;
+    while (offset + sizeof(RecordHeader) <= session.header.end && readRecord(session.db, static_cast<uint16_t>(offset / RecordAlign), record) &&
+           record.capacity % RecordAlign == 0)
+    {
+        uint16_t id = static_cast<uint16_t>(offset / RecordAlign);
+        if (!record.inUse)
+        {
+            record.nextFree = session.header.freeHead;
+            if (!writeRecord(session.db, id, record, nullptr))
+            {
+                return false;
+            }
+            session.header.freeHead = id;
+        }
+        offset += sizeof(RecordHeader) + record.capacity;
+    }
+    return true;
+}
+
+bool GolfScoreCourseDb::release(Session &session, uint16_t id, RecordHeader &record)
+{
+    record.inUse = 0;
+    record.nextFree = session.header.freeHead;
+    session.header.freeHead = id;
+    if (session.header.liveCount > 0)
+    {
+        --session.header.liveCount;
+    }
+    return writeRecord(session.db, id, record, nullptr);
+}
+
+
+uint32_t GolfScoreCourseDb::count() const
+{
+    Session session(false);
+    return session.ok() ? session.entries : 0;
+}
+
+size_t GolfScoreCourseDb::readEntries(uint32_t first, GolfScoreCourseEntry *out, size_t max) const
+{
+    Session session(false);
+    size_t slot;
+    uint32_t start;
+    if (!session.ok() || !out || max == 0 || !session.locate(first, slot, start))
+    {
+        return 0;
+    }
+
+    // One read per block the window spans
+    size_t read = 0;
+    uint32_t at = first - start;
+    while (read < max && slot < session.indexHeader.used)
+    {
+        const IndexBlock &block = session.blocks[slot];
+        size_t run = std::min<size_t>(max - read, block.fill - at);
+        size_t bytes = run * sizeof(GolfScoreCourseEntry);
+        if (!storage_file_seek(session.index, session.entryOffset(block.block, at), true) ||
+            storage_file_read(session.index, out + read, bytes) != bytes)
+        {
+            break;
+        }
+        read += run;
+        ++slot;
+        at = 0;
+    }
+    return read;
+}
+
+bool GolfScoreCourseDb::findByName(const char *name, GolfScoreCourseEntry &out) const
+{
+    Session session(false);
+    if (!session.ok() || !name)
+    {
+        return false;
+    }
+
+    GolfScoreCourseEntry key;
+    snprintf(key.name.data(), key.name.size(), "%s", name);
+    key.id = 0;
+
+    uint32_t position = session.lowerBound(key);
+    return position < session.entries && session.readEntry(position, out) && compareNames(out.name.data(), key.name.data(), key.name.size()) == 0;
+}
+
+bool GolfScoreCourseDb::load(uint16_t id, GolfScoreCourse &out) const
+{
+    Session session(false);
+    if (!session.ok() || !validId(session.header, id))
+    {
+        return false;
+    }
+
+    RecordHeader record;
+    if (!readRecord(session.db, id, record) || !record.inUse || record.holeCount < 1 || record.holeCount > GolfScoreMaxHoles ||
+        payloadBytes(record) > record.capacity ||
+        storage_file_read(session.db, out.par.data(), record.holeCount) != record.holeCount)
+    {
+        return false;
+    }
+
+    out.strokeIndex.fill(0);
+    if ((record.flags & RecordStrokeIndex) && storage_file_read(session.db, out.strokeIndex.data(), record.holeCount) != record.holeCount)
+    {
+        return false;
+    }
+
+    out.id = id;
+    out.holeCount = record.holeCount;
+    out.name = record.name;
+    out.name.back() = '\0';
+    return true;
+}
+
+
+bool GolfScoreCourseDb::narrowByPrefix(const char *prefix, uint32_t &first, uint32_t &end) const
+{
+    Session session(false);
+    if (!session.ok() || !prefix)
+    {
+        first = end = 0;
+        return false;
+    }
+
+    end = std::min(end, session.entries);
+    first = std::min(first, end);
+
+    size_t length = strnlen(prefix, GolfScoreCourseNameLength - 1);
+    if (length == 0)
+    {
+        return true;
+    }
+
+    first = session.prefixBound(first, end, prefix, length, false);
+    end = session.prefixBound(first, end, prefix, length, true);
+    return true;
+}
+
+uint16_t GolfScoreCourseDb::save(const GolfScoreCourse &course)
+{
+    if (course.holeCount < 1 || course.holeCount > GolfScoreMaxHoles)
+    {
+        return InvalidId;
+    }
+
+    Session session(true);
+    if (!session.ok())
+    {
+        return InvalidId;
+    }
+
+    RecordHeader record{};
+    record.inUse = 1;
+    record.holeCount = course.holeCount;
+    bool ranked = std::any_of(course.strokeIndex.begin(), course.strokeIndex.begin() + course.holeCount, [](uint8_t index)
+                              { return index != 0; });
+    record.flags = ranked ? RecordStrokeIndex : 0;
+    record.capacity = capacityFor(payloadBytes(record));
+    record.nextFree = InvalidId;
+    record.name = course.name;
+    record.name.back() = '\0';
+
+    uint16_t id = InvalidId;
+    RecordHeader existing;
+    GolfScoreCourseEntry old;
+    bool replacing = validId(session.header, course.id) && readRecord(session.db, course.id, existing) && existing.inUse;
+    if (replacing)
+    {
+        // The record stays put unless it grew
+        old.name = existing.name;
+        old.id = course.id;
+        old.holeCount = existing.holeCount;
+        if (existing.capacity >= payloadBytes(record))
+        {
+            id = course.id;
+            record.capacity = existing.capacity;
+        }
+    }
+    else if (session.header.liveCount >= GolfScoreMaxCourses)
+    {
+        return InvalidId;
+    }
+
+    if (id == InvalidId)
+    {
+        id = allocate(session, record.capacity);
+        if (id == InvalidId)
+        {
+            session.writeHeader();
+            return InvalidId;
+        }
+        ++session.header.liveCount;
+    }
+
+    // Record first, then the index. Until the index is done the header is
+    // flagged, so a save cut short anywhere is repaired on the next open.
+    session.header.flags |= HeaderIndexPending;
+    if (!writeRecord(session.db, id, record, &course) || !session.writeHeader() ||
+        (replacing && id != course.id && !release(session, course.id, existing)))
+    {
+        return InvalidId;
+    }
+
+    GolfScoreCourseEntry entry;
+    entry.name = record.name;
+    entry.id = id;
+    entry.holeCount = record.holeCount;
+    if ((replacing && !session.removeEntry(old)) || !session.insertEntry(entry) || !session.endIndexUpdate())
+    {
+        return InvalidId;
+    }
+    return id;
+}
+
+bool GolfScoreCourseDb::remove(uint16_t id)
+{
+    Session session(true);
+    if (!session.ok() || !validId(session.header, id))
+    {
+        return false;
+    }
+
+    RecordHeader record;
+    if (!readRecord(session.db, id, record) || !record.inUse)
+    {
+        return false;
+    }
+
+    GolfScoreCourseEntry entry;
+    entry.name = record.name;
+    entry.id = id;
+    entry.holeCount = record.holeCount;
+
+    session.header.flags |= HeaderIndexPending;
+    return release(session, id, record) && session.writeHeader() && session.removeEntry(entry) && session.endIndexUpdate();
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "golf_score_config.hpp"
+
+#include <storage/storage.h>
+
+// A course loaded from the library: only the selected course is held in RAM.
+struct GolfScoreCourse
+{
+    uint16_t id = 0xFFFF;
+    uint8_t holeCount = 0;
+    std::array<uint8_t, GolfScoreMaxHoles> par{};
+    std::array<uint8_t, GolfScoreMaxHoles> strokeIndex{}; // 0 when the course has none
+    std::array<char, GolfScoreCourseNameLength> name{};
+};
+
+// One entry of the name-sorted index, enough to list a course without
+// touching its record.
+struct GolfScoreCourseEntry
+{
+    std::array<char, GolfScoreCourseNameLength> name{};
+    uint16_t id = 0xFFFF;
+    uint8_t holeCount = 0;
+    uint8_t reserved = 0;
+};
+
+// Course library on the SD card.
+//
+// courses.db holds a small header followed by variable-length records, each
+// sized to its course's holes; a record's id is its file offset in 4-byte
+// units. Deleted records go on a free list and are reused first-fit. A
+// course that outgrows its record moves to a new one and gets a new id.
+//
+// courses.idx lists GolfScoreCourseEntry sorted by name (case-insensitive,
+// then id) in blocks of IndexBlockEntries. A directory after its header
+// gives the blocks in name order with their fill, so a position is found
+// in RAM and binary search reads one entry per probe. Inserting shifts
+// entries within one block and splits it in two when full; removing merges
+// a block into a neighbour once the pair fits in half a block, which keeps
+// the block count under MaxIndexBlocks. A save or delete therefore touches
+// O(log n) entries for the search plus at most one block, whatever the
+// library size.
+//
+// Records are written before the index. The db header flags an index
+// update in progress; a session that finds the flag set, or an index that
+// does not add up to the live record count, rebuilds the index from the
+// records.
+class GolfScoreCourseDb
+{
+public:
+    static constexpr uint16_t InvalidId = 0xFFFF;
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t freeHead; // First free record, InvalidId if none
+        uint16_t liveCount;
+        uint16_t flags; // HeaderIndexPending while courses.idx is being changed
+        uint32_t end;   // Bytes in use, where the next new record goes
+    };
+
+    // Followed by `capacity` payload bytes: holeCount pars, then holeCount
+    // stroke indices when RecordStrokeIndex is set. Records written before
+    // stroke indices existed have the flag clear and stay readable.
+    struct RecordHeader
+    {
+        uint8_t inUse;
+        uint8_t holeCount;
+        uint8_t capacity;
+        uint8_t flags;
+        uint16_t nextFree;
+        uint16_t reserved2;
+        std::array<char, GolfScoreCourseNameLength> name;
+    };
+    static_assert(sizeof(RecordHeader) == 24, "courses.db record layout changed");
+
+    static constexpr uint32_t RecordAlign = 4;
+    static constexpr uint8_t RecordStrokeIndex = 0x01;
+    static constexpr uint16_t HeaderIndexPending = 0x0001;
+
+    static constexpr uint8_t IndexBlockEntries = 32;
+    static constexpr uint8_t MaxIndexBlocks = 128;
+    // Adjacent blocks hold more than half a block between them
+    static_assert(2 * GolfScoreMaxCourses / (IndexBlockEntries / 2 + 1) + 1 <= MaxIndexBlocks, "courses.idx directory too small");
+
+    struct IndexHeader
+    {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t blockCount; // Blocks in the file, used or free
+        uint8_t used;       // Directory slots in use
+        uint8_t reserved;
+    };
+
+    // Directory slot: a block in the file and how many entries it holds
+    struct IndexBlock
+    {
+        uint8_t block;
+        uint8_t fill;
+    };
+
+    // Both files are opened per operation and closed again on scope exit
+    class Session
+    {
+    private:
+        Storage *storage = nullptr;
+
+        bool open(bool write);
+        void closeFiles();
+        bool indexReady();
+        bool rebuildIndex();
+        bool takeBlock(uint8_t &block);
+        bool moveEntries(uint8_t fromBlock, uint32_t from, uint8_t toBlock, uint32_t to, uint32_t count);
+        void dropSlot(size_t slot);
+        bool mergeAt(size_t slot);
+
+    public:
+        File *db = nullptr;
+        File *index = nullptr;
+        Header header{};
+        IndexHeader indexHeader{};
+        std::array<IndexBlock, MaxIndexBlocks> blocks{};
+        uint32_t entries = 0;
+
+        Session(bool write);
+        ~Session();
+        bool ok() const { return db && index; }
+        bool writeHeader();
+        bool writeIndexHeader();
+        uint32_t entryOffset(uint8_t block, uint32_t slot) const;
+        bool locate(uint32_t position, size_t &slot, uint32_t &first) const;
+        bool readEntry(uint32_t position, GolfScoreCourseEntry &out);
+        uint32_t lowerBound(const GolfScoreCourseEntry &key);
+        uint32_t prefixBound(uint32_t low, uint32_t high, const char *prefix, size_t length, bool upper);
+        bool insertEntry(const GolfScoreCourseEntry &entry);
+        bool removeEntry(const GolfScoreCourseEntry &entry);
+        bool beginIndexUpdate();
+        bool endIndexUpdate();
+    };
+
+    static uint32_t recordOffset(uint16_t id);
+    static uint8_t capacityFor(uint8_t payload);
+    static uint8_t payloadBytes(const RecordHeader &record);
+    static bool validId(const Header &header, uint16_t id);
+    static int compare(const GolfScoreCourseEntry &a, const GolfScoreCourseEntry &b);
+    static bool readRecord(File *db, uint16_t id, RecordHeader &out);
+    static bool writeRecord(File *db, uint16_t id, const RecordHeader &record, const GolfScoreCourse *course);
+    static uint16_t allocate(Session &session, uint8_t &capacity);
+    static bool release(Session &session, uint16_t id, RecordHeader &record);
+    static bool relinkFree(Session &session);
+
+public:
+    // Case-insensitive order used by the index; compares at most `length` chars.
+    static int compareNames(const char *a, const char *b, size_t length);
+
+    static void path(char *out, size_t size, const char *file);
+
+    uint32_t count() const;
+    size_t readEntries(uint32_t first, GolfScoreCourseEntry *out, size_t max) const;
+    bool findByName(const char *name, GolfScoreCourseEntry &out) const;
+    bool load(uint16_t id, GolfScoreCourse &out) const;
+
+    // Narrows the index range [first, end) to names starting with `prefix`.
+    // Extending a prefix only needs to search the previous range.
+    bool narrowByPrefix(const char *prefix, uint32_t &first, uint32_t &end) const;
+
+    // Writes `course`; an id of InvalidId adds a new record. Returns the id
+    // used, which differs from course.id when the course grew.
+    uint16_t save(const GolfScoreCourse &course);
+    bool remove(uint16_t id);
+};
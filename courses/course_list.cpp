@@ -0,0 +1,286 @@
+#include "courses/course_list.hpp"
+#include "app.hpp"
+#include "debug/trace.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+GolfScoreCourseList::GolfScoreCourseList(ViewDispatcher **viewDispatcher) : viewDispatcherRef(viewDispatcher)
+{
+}
+
+GolfScoreCourseList::~GolfScoreCourseList()
+{
+    if (listView && viewDispatcherRef && *viewDispatcherRef)
+    {
+        view_dispatcher_remove_view(*viewDispatcherRef, GolfScoreViewCourseList);
+        view_free(listView);
+        listView = nullptr;
+    }
+}
+
+uint32_t GolfScoreCourseList::callbackToSettings(void *context)
+{
+    UNUSED(context);
+    return GolfScoreViewSettings;
+}
+
+bool GolfScoreCourseList::show(const char *listTitle, bool withNewRow, GolfScoreCourseListCallback onSelect, GolfScoreCourseSearchCallback onSearch, void *context)
+{
+    if (!viewDispatcherRef || !*viewDispatcherRef)
+    {
+        return false;
+    }
+
+    if (!listView)
+    {
+        if (!easy_flipper_set_view(&listView, GolfScoreViewCourseList, listDraw, listInput, callbackToSettings, viewDispatcherRef, this))
+        {
+            listView = nullptr;
+            return false;
+        }
+        view_allocate_model(listView, ViewModelTypeLocking, sizeof(ListModel));
+    }
+
+    title = listTitle ? listTitle : "";
+    offerNew = withNewRow;
+    callback = onSelect;
+    searchCallback = onSearch;
+    callbackContext = context;
+    prefix[0] = '\0';
+    selected = 0;
+    top = 0;
+    refresh();
+
+    golf_score_switch_view(*viewDispatcherRef, GolfScoreViewCourseList);
+    return true;
+}
+
+void GolfScoreCourseList::reopen()
+{
+    if (listView && viewDispatcherRef && *viewDispatcherRef)
+    {
+        golf_score_switch_view(*viewDispatcherRef, GolfScoreViewCourseList);
+    }
+}
+
+void GolfScoreCourseList::refresh()
+{
+    rangeFirst = 0;
+    rangeEnd = UINT32_MAX;
+    db.narrowByPrefix(prefix, rangeFirst, rangeEnd);
+
+    uint32_t total = rowTotal();
+    if (selected >= total)
+    {
+        selected = total - 1;
+    }
+    if (selected < top || selected >= top + VisibleRows)
+    {
+        top = selected >= VisibleRows ? selected - VisibleRows + 1 : 0;
+    }
+    refreshWindow();
+}
+
+uint32_t GolfScoreCourseList::setPrefix(const char *text)
+{
+    if (!text)
+    {
+        text = "";
+    }
+
+    size_t oldLength = strlen(prefix);
+    bool extends = strlen(text) >= oldLength && GolfScoreCourseDb::compareNames(text, prefix, oldLength) == 0;
+    snprintf(prefix, sizeof(prefix), "%s", text);
+
+    // A longer prefix only searches the current range; anything else starts over
+    if (!extends)
+    {
+        rangeFirst = 0;
+        rangeEnd = UINT32_MAX;
+    }
+    db.narrowByPrefix(prefix, rangeFirst, rangeEnd);
+
+    selected = matchCount() > 0 ? leadingRows() : 0;
+    top = 0;
+    refreshWindow();
+    return matchCount();
+}
+
+bool GolfScoreCourseList::firstMatch(GolfScoreCourseEntry &out) const
+{
+    return matchCount() > 0 && db.readEntries(rangeFirst, &out, 1) == 1;
+}
+
+void GolfScoreCourseList::refreshWindow()
+{
+    if (!listView)
+    {
+        return;
+    }
+
+    // Row positions include the leading rows; index positions do not
+    uint32_t leading = top < leadingRows() ? leadingRows() - top : 0;
+    uint32_t firstEntry = top > leadingRows() ? top - leadingRows() : 0;
+    size_t wanted = std::min<size_t>(VisibleRows - leading, matchCount() > firstEntry ? matchCount() - firstEntry : 0);
+    windowCount = static_cast<uint8_t>(db.readEntries(rangeFirst + firstEntry, window, wanted));
+
+    auto *model = static_cast<ListModel *>(view_get_model(listView));
+    model->total = rowTotal();
+    model->selected = selected;
+    model->top = top;
+    model->matches = matchCount();
+    snprintf(model->title, sizeof(model->title), "%s", title);
+
+    uint8_t rowCount = 0;
+    for (uint32_t row = top; row < leadingRows(); ++row)
+    {
+        if (row == 0)
+        {
+            if (prefix[0] != '\0')
+            {
+                snprintf(model->rows[rowCount++].label, sizeof(Row::label), "Search: %s", prefix);
+            }
+            else
+            {
+                snprintf(model->rows[rowCount++].label, sizeof(Row::label), "Search...");
+            }
+        }
+        else
+        {
+            snprintf(model->rows[rowCount++].label, sizeof(Row::label), "+ New course");
+        }
+    }
+    for (uint8_t i = 0; i < windowCount; ++i)
+    {
+        snprintf(model->rows[rowCount++].label, sizeof(Row::label), "%-15.15s %2u", window[i].name.data(), static_cast<unsigned>(window[i].holeCount));
+    }
+    model->rowCount = rowCount;
+    view_commit_model(listView, true);
+}
+
+void GolfScoreCourseList::moveSelection(int32_t delta)
+{
+    uint32_t total = rowTotal();
+    int64_t next = static_cast<int64_t>(selected) + delta;
+    next = std::clamp<int64_t>(next, 0, static_cast<int64_t>(total) - 1);
+    if (static_cast<uint32_t>(next) == selected)
+    {
+        return;
+    }
+
+    selected = static_cast<uint32_t>(next);
+    if (selected < top)
+    {
+        top = selected;
+    }
+    else if (selected >= top + VisibleRows)
+    {
+        top = selected - VisibleRows + 1;
+    }
+
+    refreshWindow();
+}
+
+void GolfScoreCourseList::select()
+{
+    if (selected == 0)
+    {
+        if (searchCallback)
+        {
+            searchCallback(callbackContext);
+        }
+        return;
+    }
+
+    if (!callback)
+    {
+        return;
+    }
+
+    if (selected < leadingRows())
+    {
+        callback(callbackContext, nullptr);
+        return;
+    }
+
+    uint32_t row = selected - std::max(top, leadingRows());
+    if (row < windowCount)
+    {
+        GolfScoreCourseEntry entry = window[row];
+        callback(callbackContext, &entry);
+    }
+}
+
+void GolfScoreCourseList::listDraw(Canvas *canvas, void *model)
+{
+    auto *list = static_cast<ListModel *>(model);
+    if (!canvas || !list)
+    {
+        return;
+    }
+
+    canvas_clear(canvas);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_set_font_custom(canvas, FONT_SIZE_SMALL);
+
+    char header[32];
+    snprintf(header, sizeof(header), "%s %lu courses", list->title, static_cast<unsigned long>(list->matches));
+    canvas_draw_str(canvas, 2, 7, header);
+
+    canvas_set_font_custom(canvas, FONT_SIZE_MEDIUM);
+    for (uint8_t i = 0; i < list->rowCount; ++i)
+    {
+        uint8_t y = static_cast<uint8_t>(18 + i * 10);
+        bool highlight = list->top + i == list->selected;
+        if (highlight)
+        {
+            canvas_draw_box(canvas, 0, y - 8, 128, 10);
+            canvas_set_color(canvas, ColorWhite);
+        }
+        canvas_draw_str(canvas, 2, y, list->rows[i].label);
+        if (highlight)
+        {
+            canvas_set_color(canvas, ColorBlack);
+        }
+    }
+}
+
+bool GolfScoreCourseList::listInput(InputEvent *event, void *context)
+{
+    auto *list = static_cast<GolfScoreCourseList *>(context);
+    if (!list || !event)
+    {
+        return false;
+    }
+
+    if (event->type != InputTypeShort && event->type != InputTypeRepeat)
+    {
+        return false;
+    }
+
+    switch (event->key)
+    {
+    case InputKeyUp:
+        list->moveSelection(-1);
+        return true;
+    case InputKeyDown:
+        list->moveSelection(1);
+        return true;
+    case InputKeyLeft:
+        list->moveSelection(-static_cast<int32_t>(VisibleRows));
+        return true;
+    case InputKeyRight:
+        list->moveSelection(VisibleRows);
+        return true;
+    case InputKeyOk:
+        if (event->type == InputTypeShort)
+        {
+            list->select();
+        }
+        return true;
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+
+#include "easy_flipper/easy_flipper.h"
+#include "courses/course_db.hpp"
+
+// Called with the chosen course, or nullptr for the "New course" row.
+typedef void (*GolfScoreCourseListCallback)(void *context, const GolfScoreCourseEntry *entry);
+// Called when the "Search" row is chosen.
+typedef void (*GolfScoreCourseSearchCallback)(void *context);
+
+// Paged list over the course library. Only the visible window of index
+// entries is read from the SD card; a name prefix narrows the list to a
+// range of the sorted index.
+class GolfScoreCourseList
+{
+private:
+    static constexpr uint8_t VisibleRows = 5;
+
+    struct Row
+    {
+        char label[32];
+    };
+
+    struct ListModel
+    {
+        uint32_t total;
+        uint32_t selected;
+        uint32_t top;
+        uint32_t matches;
+        uint8_t rowCount;
+        char title[16];
+        Row rows[VisibleRows];
+    };
+
+    ViewDispatcher **viewDispatcherRef;
+    View *listView = nullptr;
+    GolfScoreCourseDb db;
+    GolfScoreCourseEntry window[VisibleRows];
+    uint8_t windowCount = 0;
+    uint32_t rangeFirst = 0; // Index range matching the prefix
+    uint32_t rangeEnd = 0;
+    char prefix[GolfScoreCourseNameLength] = {};
+    uint32_t selected = 0;
+    uint32_t top = 0;
+    bool offerNew = false;
+    const char *title = "";
+    GolfScoreCourseListCallback callback = nullptr;
+    GolfScoreCourseSearchCallback searchCallback = nullptr;
+    void *callbackContext = nullptr;
+
+    static uint32_t callbackToSettings(void *context);
+    static void listDraw(Canvas *canvas, void *model);
+    static bool listInput(InputEvent *event, void *context);
+    uint32_t leadingRows() const { return offerNew ? 2 : 1; }
+    uint32_t rowTotal() const { return leadingRows() + matchCount(); }
+    void moveSelection(int32_t delta);
+    void refreshWindow();
+    void select();
+
+public:
+    GolfScoreCourseList(ViewDispatcher **viewDispatcher);
+    ~GolfScoreCourseList();
+
+    // Lists the library; offerNew adds a "New course" row after "Search".
+    bool show(const char *listTitle, bool withNewRow, GolfScoreCourseListCallback onSelect, GolfScoreCourseSearchCallback onSearch, void *context);
+    // Re-reads the library after it changed, keeping the prefix and selection.
+    void refresh();
+    // Switches back to the list view, e.g. after the search input closes.
+    void reopen();
+
+    // Narrows the list to names starting with `text`; returns the match count.
+    uint32_t setPrefix(const char *text);
+    const char *getPrefix() const { return prefix; }
+    uint32_t matchCount() const { return rangeEnd - rangeFirst; }
+    // First course matching the prefix, if any.
+    bool firstMatch(GolfScoreCourseEntry &out) const;
+};
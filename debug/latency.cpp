@@ -0,0 +1,223 @@
+#include "debug/latency.hpp"
+#include "debug/perf_counters.hpp"
+#include "app.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <storage/storage.h>
+
+namespace
+{
+    constexpr uint32_t LatencyMagic = 0x484C5347; // "GSLH"
+    constexpr uint8_t LatencyVersion = 1;
+
+    struct LatencyHeader
+    {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t opCount;
+        uint8_t bucketCount;
+        uint8_t reserved;
+    };
+    static_assert(sizeof(LatencyHeader) == 8, "latency.bin header layout changed");
+    static_assert(sizeof(GolfScoreLatencyHistogram) == (GolfScoreLatencyBuckets + 1) * sizeof(uint32_t), "latency.bin histogram layout changed");
+
+    const char *const OpNames[GolfScoreLatencyOpCount] = {"save", "history_append", "history_open", "history_read"};
+
+    GolfScoreLatencyHistogram histograms[GolfScoreLatencyOpCount] = {};
+    bool dirty = false;
+
+    void dataPath(char *path, size_t size, const char *name)
+    {
+        snprintf(path, size, STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, name);
+    }
+}
+
+uint8_t golf_score_latency_bucket(uint32_t us)
+{
+    return us == 0 ? 0 : static_cast<uint8_t>(std::min<uint32_t>(GolfScoreLatencyBuckets - 1, 32 - __builtin_clz(us)));
+}
+
+void golf_score_latency_record(GolfScoreLatencyOp op, uint32_t us)
+{
+    if (op >= GolfScoreLatencyOpCount)
+    {
+        return;
+    }
+    GolfScoreLatencyHistogram &histogram = histograms[op];
+    ++histogram.counts[golf_score_latency_bucket(us)];
+    histogram.maxUs = std::max(histogram.maxUs, us);
+    dirty = true;
+}
+
+const GolfScoreLatencyHistogram &golf_score_latency(GolfScoreLatencyOp op)
+{
+    return histograms[op < GolfScoreLatencyOpCount ? op : 0];
+}
+
+void golf_score_latency_clear()
+{
+    memset(histograms, 0, sizeof(histograms));
+    dirty = false;
+}
+
+bool golf_score_latency_load()
+{
+    golf_score_latency_clear();
+
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        return false;
+    }
+
+    File *file = storage_file_alloc(storage);
+    char path[128];
+    dataPath(path, sizeof(path), "latency.bin");
+    bool ok = false;
+    if (file && storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING))
+    {
+        // Older files with fewer operations load what they have; a newer
+        // file's extra operations are dropped when this version saves
+        LatencyHeader header{};
+        ok = storage_file_read(file, &header, sizeof(header)) == sizeof(header) &&
+             header.magic == LatencyMagic && header.version == LatencyVersion &&
+             header.bucketCount == GolfScoreLatencyBuckets;
+        if (ok)
+        {
+            size_t bytes = std::min<size_t>(header.opCount, GolfScoreLatencyOpCount) * sizeof(GolfScoreLatencyHistogram);
+            ok = storage_file_read(file, histograms, bytes) == bytes;
+        }
+        if (!ok)
+        {
+            FURI_LOG_E(TAG, "Ignoring unreadable %s", path);
+            golf_score_latency_clear();
+        }
+        storage_file_close(file);
+    }
+
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+    return ok;
+}
+
+bool golf_score_latency_save()
+{
+    if (!dirty)
+    {
+        return true;
+    }
+
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        return false;
+    }
+
+    File *file = storage_file_alloc(storage);
+    char path[128];
+    dataPath(path, sizeof(path), "latency.bin");
+    bool ok = false;
+    if (file && storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS))
+    {
+        LatencyHeader header{LatencyMagic, LatencyVersion, GolfScoreLatencyOpCount, GolfScoreLatencyBuckets, 0};
+        ok = golf_score_file_write(file, &header, sizeof(header)) == sizeof(header) &&
+             golf_score_file_write(file, histograms, sizeof(histograms)) == sizeof(histograms);
+        storage_file_close(file);
+    }
+    if (ok)
+    {
+        dirty = false;
+    }
+    else
+    {
+        FURI_LOG_E(TAG, "Failed to write %s", path);
+    }
+
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+    return ok;
+}
+
+bool golf_score_latency_export_csv()
+{
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        return false;
+    }
+
+    File *file = storage_file_alloc(storage);
+    char path[128];
+    dataPath(path, sizeof(path), "latency.csv");
+    bool ok = false;
+    if (file && storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS))
+    {
+        char line[320];
+        int length = snprintf(line, sizeof(line), "op,samples,max_us,0");
+        for (uint8_t bucket = 1; bucket < GolfScoreLatencyBuckets && length > 0; ++bucket)
+        {
+            length += snprintf(line + length, sizeof(line) - length, ",%lu", 1ul << (bucket - 1));
+        }
+        ok = length > 0 && static_cast<size_t>(length) < sizeof(line) - 1;
+        if (ok)
+        {
+            line[length++] = '\n';
+            ok = golf_score_file_write(file, line, static_cast<size_t>(length)) == static_cast<size_t>(length);
+        }
+
+        for (uint8_t op = 0; ok && op < GolfScoreLatencyOpCount; ++op)
+        {
+            const GolfScoreLatencyHistogram &histogram = histograms[op];
+            uint32_t samples = 0;
+            for (uint32_t count : histogram.counts)
+            {
+                samples += count;
+            }
+            length = snprintf(line, sizeof(line), "%s,%lu,%lu", OpNames[op], static_cast<unsigned long>(samples), static_cast<unsigned long>(histogram.maxUs));
+            for (uint32_t count : histogram.counts)
+            {
+                if (length > 0)
+                {
+                    length += snprintf(line + length, sizeof(line) - length, ",%lu", static_cast<unsigned long>(count));
+                }
+            }
+            ok = length > 0 && static_cast<size_t>(length) < sizeof(line) - 1;
+            if (ok)
+            {
+                line[length++] = '\n';
+                ok = golf_score_file_write(file, line, static_cast<size_t>(length)) == static_cast<size_t>(length);
+            }
+        }
+        storage_file_close(file);
+    }
+    if (!ok)
+    {
+        FURI_LOG_E(TAG, "Failed to write %s", path);
+    }
+
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+    return ok;
+}
+
+GolfScoreLatencyScope::GolfScoreLatencyScope(GolfScoreLatencyOp op)
+    : op(op), start(golf_score_perf_cycles())
+{
+}
+
+GolfScoreLatencyScope::~GolfScoreLatencyScope()
+{
+    golf_score_latency_record(op, golf_score_perf_elapsed_us(start));
+}
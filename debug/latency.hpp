@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Log2 latency histograms for the storage paths, kept across sessions in
+// /ext/apps_data/golf_score/data/latency.bin so SD cards and firmware
+// versions can be compared in the field. Settings > Export Timings writes
+// them to latency.csv:
+//
+//   op,samples,max_us,0,1,2,4,...,4194304
+//
+// The bucket columns are headed by their lower bound in microseconds; each
+// holds samples below the next column's bound, and the last is open-ended.
+// Recording is a counter read and two adds; the file is read when the app
+// starts and written on exit only if something was recorded.
+typedef enum
+{
+    GolfScoreLatencySave = 0,          // saveState(): full state.bin rewrite
+    GolfScoreLatencyHistoryAppend = 1, // exportRoundHistory()
+    GolfScoreLatencyHistoryOpen = 2,   // Indexing rounds.csv when history opens
+    GolfScoreLatencyHistoryRead = 3,   // Fetching a round the reader had not cached
+    GolfScoreLatencyOpCount = 4,
+} GolfScoreLatencyOp;
+
+constexpr uint8_t GolfScoreLatencyBuckets = 24;
+
+struct GolfScoreLatencyHistogram
+{
+    uint32_t counts[GolfScoreLatencyBuckets];
+    uint32_t maxUs;
+};
+
+// Bucket 0 is under 1 us, bucket b in [2^(b-1), 2^b) us, the last is open
+uint8_t golf_score_latency_bucket(uint32_t us);
+void golf_score_latency_record(GolfScoreLatencyOp op, uint32_t us);
+const GolfScoreLatencyHistogram &golf_score_latency(GolfScoreLatencyOp op);
+void golf_score_latency_clear();
+
+bool golf_score_latency_load();
+// Writes latency.bin if anything was recorded since the last load or save
+bool golf_score_latency_save();
+bool golf_score_latency_export_csv();
+
+// Records the time from construction to destruction
+class GolfScoreLatencyScope
+{
+private:
+    GolfScoreLatencyOp op;
+    uint32_t start;
+
+public:
+    explicit GolfScoreLatencyScope(GolfScoreLatencyOp op);
+    ~GolfScoreLatencyScope();
+
+    GolfScoreLatencyScope(const GolfScoreLatencyScope &) = delete;
+    GolfScoreLatencyScope &operator=(const GolfScoreLatencyScope &) = delete;
+};
@@ -0,0 +1,65 @@
+#include "debug/memory_probe.hpp"
+
+#ifdef GOLF_SCORE_DEBUG_MEMORY
+
+#include "app.hpp"
+
+#include <cstdio>
+
+#include <storage/storage.h>
+
+GolfScoreMemoryProbe::GolfScoreMemoryProbe(const char *operation)
+    : operation(operation),
+      stackBefore(furi_thread_get_stack_space(furi_thread_get_current_id())),
+      heapBefore(memmgr_get_free_heap())
+{
+}
+
+GolfScoreMemoryProbe::~GolfScoreMemoryProbe()
+{
+    // Sample before logging so the log write itself is not counted
+    uint32_t stackAfter = furi_thread_get_stack_space(furi_thread_get_current_id());
+    size_t heapAfter = memmgr_get_free_heap();
+    size_t heapMin = memmgr_get_minimum_free_heap();
+
+    char line[96];
+    int length = snprintf(line, sizeof(line), "%s,%lu,%lu,%lu,%ld,%lu\n",
+                          operation,
+                          static_cast<unsigned long>(stackAfter),
+                          static_cast<unsigned long>(stackBefore > stackAfter ? stackBefore - stackAfter : 0),
+                          static_cast<unsigned long>(heapAfter),
+                          static_cast<long>(heapAfter) - static_cast<long>(heapBefore),
+                          static_cast<unsigned long>(heapMin));
+    FURI_LOG_D(TAG, "mem %s", line);
+
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        return;
+    }
+
+    File *file = storage_file_alloc(storage);
+    char path[128];
+    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/memory.log", APP_ID);
+    if (file && storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_APPEND))
+    {
+        if (storage_file_size(file) == 0)
+        {
+            static const char header[] = "op,stack_free_min,stack_dropped,heap_free,heap_delta,heap_free_min\n";
+            storage_file_write(file, header, sizeof(header) - 1);
+        }
+        if (length > 0)
+        {
+            storage_file_write(file, line, static_cast<size_t>(length) < sizeof(line) ? static_cast<size_t>(length) : sizeof(line) - 1);
+        }
+        storage_file_close(file);
+    }
+
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+}
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Memory instrumentation for sizing buffers and the app stack.
+//
+// Build with GOLF_SCORE_DEBUG_MEMORY defined (see application.fam) and each
+// probed operation appends one line to
+// /ext/apps_data/golf_score/data/memory.log:
+//
+//   op,stack_free_min,stack_dropped,heap_free,heap_delta,heap_free_min
+//
+// stack_free_min is the thread's lifetime stack watermark after the
+// operation and stack_dropped how far this operation lowered it.
+// heap_free_min is the system-wide low-water mark. In normal builds the
+// probe compiles away.
+#ifdef GOLF_SCORE_DEBUG_MEMORY
+
+class GolfScoreMemoryProbe
+{
+private:
+    const char *operation;
+    uint32_t stackBefore;
+    size_t heapBefore;
+
+public:
+    explicit GolfScoreMemoryProbe(const char *operation);
+    ~GolfScoreMemoryProbe();
+
+    GolfScoreMemoryProbe(const GolfScoreMemoryProbe &) = delete;
+    GolfScoreMemoryProbe &operator=(const GolfScoreMemoryProbe &) = delete;
+};
+
+#define GOLF_SCORE_MEMORY_PROBE(operation) GolfScoreMemoryProbe golf_score_memory_probe_(operation)
+
+#else
+
+#define GOLF_SCORE_MEMORY_PROBE(operation) ((void)0)
+
+#endif
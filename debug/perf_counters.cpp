@@ -0,0 +1,53 @@
+#include "debug/perf_counters.hpp"
+
+#ifdef GOLF_SCORE_HOST
+#include <time.h>
+#else
+#include <furi_hal.h>
+#endif
+
+GolfScorePerfCounters golf_score_perf = {};
+
+uint32_t golf_score_perf_cycles()
+{
+#ifdef GOLF_SCORE_HOST
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<uint32_t>(static_cast<uint64_t>(time.tv_sec) * 1000000000u + static_cast<uint64_t>(time.tv_nsec));
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+uint32_t golf_score_perf_elapsed_us(uint32_t since)
+{
+#ifdef GOLF_SCORE_HOST
+    uint32_t perMicrosecond = 1000;
+#else
+    uint32_t perMicrosecond = furi_hal_cortex_instructions_per_microsecond();
+#endif
+    return (golf_score_perf_cycles() - since) / perMicrosecond;
+}
+
+void golf_score_perf_input()
+{
+    // Zero means "drawn", so a stamp that happens to be zero is nudged
+    golf_score_perf.inputCycles = golf_score_perf_cycles() | 1;
+}
+
+void golf_score_perf_drawn()
+{
+    uint32_t since = golf_score_perf.inputCycles;
+    if (since)
+    {
+        golf_score_perf.inputToDrawUs = golf_score_perf_elapsed_us(since);
+        golf_score_perf.inputCycles = 0;
+    }
+}
+
+size_t golf_score_file_write(File *file, const void *buffer, size_t size)
+{
+    size_t written = storage_file_write(file, buffer, size);
+    golf_score_perf.sdBytesWritten += static_cast<uint32_t>(written);
+    return written;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <storage/storage.h>
+
+// Always-on counters behind the scorecard's performance HUD (hold OK on the
+// stats page). Each hot path pays one cycle-counter read or one add, so the
+// HUD shows what the release build does on real hardware.
+struct GolfScorePerfCounters
+{
+    uint32_t inputCycles;    // Stamp of the last input still waiting for a frame, 0 once drawn
+    uint32_t inputToDrawUs;  // Input event to the end of the next scorecard frame
+    uint32_t saveUs;         // Last saveState(), journal appends excluded
+    uint32_t sdBytesWritten; // Everything the app wrote to SD this session
+};
+
+extern GolfScorePerfCounters golf_score_perf;
+
+// Free-running cycle counter (DWT on the device, nanoseconds on the host);
+// differences hold for about a minute on the device and four seconds here
+uint32_t golf_score_perf_cycles();
+uint32_t golf_score_perf_elapsed_us(uint32_t since);
+
+void golf_score_perf_input();
+void golf_score_perf_drawn();
+
+// storage_file_write() that counts towards sdBytesWritten
+size_t golf_score_file_write(File *file, const void *buffer, size_t size);
@@ -0,0 +1,251 @@
+#include "debug/trace.hpp"
+
+#ifdef GOLF_SCORE_TRACE
+
+#include "app.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include <storage/storage.h>
+
+#ifdef GOLF_SCORE_HOST
+#include <time.h>
+#else
+#include <furi_hal.h>
+#endif
+
+namespace
+{
+    struct TraceStamp
+    {
+        uint64_t cycles;
+        const char *name;
+        uint16_t arg;
+        char phase; // 'B' or 'E', as in the trace event format
+        uint8_t thread;
+    };
+
+    constexpr size_t MaxThreads = 4;
+
+    TraceStamp stamps[GolfScoreTraceCapacity];
+    size_t next = 0;
+    size_t count = 0;
+    FuriThreadId threads[MaxThreads] = {};
+
+#ifdef GOLF_SCORE_HOST
+    // Nanoseconds stand in for cycles
+    uint32_t cyclesPerMicrosecond()
+    {
+        return 1000;
+    }
+
+    uint64_t now()
+    {
+        timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return static_cast<uint64_t>(time.tv_sec) * 1000000000u + static_cast<uint64_t>(time.tv_nsec);
+    }
+#else
+    uint32_t lastCycles = 0;
+    uint32_t lastTick = 0;
+    uint64_t clock = 0;
+
+    uint32_t cyclesPerMicrosecond()
+    {
+        return furi_hal_cortex_instructions_per_microsecond();
+    }
+
+    // CYCCNT wraps every 67 s at 64 MHz; the tick says how many wraps a
+    // long gap between stamps hides. Called inside the critical section.
+    uint64_t now()
+    {
+        uint32_t cycles = DWT->CYCCNT;
+        uint32_t tick = furi_get_tick();
+        uint64_t elapsed = static_cast<uint32_t>(cycles - lastCycles);
+        uint64_t expected = static_cast<uint64_t>(tick - lastTick) * cyclesPerMicrosecond() * 1000;
+        while (elapsed + (1ull << 31) < expected)
+        {
+            elapsed += 1ull << 32;
+        }
+        lastCycles = cycles;
+        lastTick = tick;
+        clock += elapsed;
+        return clock;
+    }
+#endif
+
+    uint8_t threadIndex(FuriThreadId id)
+    {
+        for (uint8_t i = 0; i < MaxThreads; ++i)
+        {
+            if (threads[i] == id || !threads[i])
+            {
+                threads[i] = id;
+                return i;
+            }
+        }
+        return MaxThreads - 1;
+    }
+
+    void record(const char *name, char phase, uint16_t arg)
+    {
+        FURI_CRITICAL_ENTER();
+        TraceStamp &stamp = stamps[next];
+        stamp.cycles = now();
+        stamp.name = name;
+        stamp.arg = arg;
+        stamp.phase = phase;
+        stamp.thread = threadIndex(furi_thread_get_current_id());
+        next = (next + 1) % GolfScoreTraceCapacity;
+        if (count < GolfScoreTraceCapacity)
+        {
+            ++count;
+        }
+        FURI_CRITICAL_EXIT();
+    }
+
+    // Collects events into whole SD blocks instead of writing each one
+    struct TraceWriter
+    {
+        File *file;
+        char buffer[512];
+        size_t used = 0;
+        bool ok = true;
+
+        explicit TraceWriter(File *file) : file(file) {}
+
+        void flush()
+        {
+            ok = ok && storage_file_write(file, buffer, used) == used;
+            used = 0;
+        }
+
+        void append(const char *text, size_t length)
+        {
+            if (used + length > sizeof(buffer))
+            {
+                flush();
+            }
+            memcpy(buffer + used, text, length);
+            used += length;
+        }
+    };
+}
+
+GolfScoreTraceScope::GolfScoreTraceScope(const char *name, uint16_t arg)
+    : name(name)
+{
+    record(name, 'B', arg);
+}
+
+GolfScoreTraceScope::~GolfScoreTraceScope()
+{
+    record(name, 'E', GolfScoreTraceNoArg);
+}
+
+size_t golf_score_trace_count()
+{
+    return count;
+}
+
+void golf_score_trace_clear()
+{
+    FURI_CRITICAL_ENTER();
+    next = 0;
+    count = 0;
+    FURI_CRITICAL_EXIT();
+}
+
+bool golf_score_trace_dump()
+{
+    // Copy first so scopes closing during the SD writes cannot tear the ring
+    static TraceStamp copy[GolfScoreTraceCapacity];
+    FURI_CRITICAL_ENTER();
+    size_t total = count;
+    size_t first = (next + GolfScoreTraceCapacity - count) % GolfScoreTraceCapacity;
+    for (size_t i = 0; i < total; ++i)
+    {
+        copy[i] = stamps[(first + i) % GolfScoreTraceCapacity];
+    }
+    FURI_CRITICAL_EXIT();
+
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        return false;
+    }
+
+    File *file = storage_file_alloc(storage);
+    char path[128];
+    snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/trace.json", APP_ID);
+    bool ok = file && storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+    if (ok)
+    {
+        TraceWriter writer(file);
+        static const char header[] = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        writer.append(header, sizeof(header) - 1);
+
+        // The ring drops the oldest stamps, so an end can outlive its begin;
+        // such ends are skipped to keep every track balanced
+        uint32_t depth[MaxThreads] = {};
+        uint32_t perMicrosecond = cyclesPerMicrosecond();
+        uint64_t base = total ? copy[0].cycles : 0;
+        bool firstEvent = true;
+        for (size_t i = 0; i < total; ++i)
+        {
+            const TraceStamp &stamp = copy[i];
+            if (stamp.phase == 'E')
+            {
+                if (depth[stamp.thread] == 0)
+                {
+                    continue;
+                }
+                --depth[stamp.thread];
+            }
+            else
+            {
+                ++depth[stamp.thread];
+            }
+
+            uint64_t cycles = stamp.cycles - base;
+            char event[160];
+            int length = snprintf(event, sizeof(event), "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lu.%03lu,\"pid\":1,\"tid\":%u",
+                                  firstEvent ? "" : ",\n",
+                                  stamp.name,
+                                  stamp.phase,
+                                  static_cast<unsigned long>(cycles / perMicrosecond),
+                                  static_cast<unsigned long>(cycles % perMicrosecond * 1000 / perMicrosecond),
+                                  static_cast<unsigned>(stamp.thread + 1));
+            if (length > 0 && stamp.phase == 'B' && stamp.arg != GolfScoreTraceNoArg)
+            {
+                length += snprintf(event + length, sizeof(event) - length, ",\"args\":{\"value\":%u}", static_cast<unsigned>(stamp.arg));
+            }
+            if (length > 0 && static_cast<size_t>(length) < sizeof(event) - 1)
+            {
+                event[length++] = '}';
+                writer.append(event, static_cast<size_t>(length));
+                firstEvent = false;
+            }
+        }
+
+        static const char footer[] = "]}\n";
+        writer.append(footer, sizeof(footer) - 1);
+        writer.flush();
+        ok = writer.ok;
+        storage_file_close(file);
+    }
+    if (!ok)
+    {
+        FURI_LOG_E(TAG, "Failed to write %s", path);
+    }
+
+    if (file)
+    {
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+    return ok;
+}
+
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gui/view_dispatcher.h>
+
+// Cycle-stamped tracepoints for finding where a keypress's time goes.
+//
+// Build with GOLF_SCORE_TRACE defined (see application.fam) and each traced
+// scope records a begin and an end stamp from the Cortex-M4 DWT cycle
+// counter (CLOCK_MONOTONIC on the host) into a fixed RAM ring holding the
+// last GolfScoreTraceCapacity stamps. The ring is written to
+// /ext/apps_data/golf_score/data/trace.json as Chrome trace events when the
+// app exits; open it in chrome://tracing or ui.perfetto.dev. Scopes on the
+// GUI thread (drawing) and the app thread (input, saves) get their own
+// tracks. In normal builds the tracepoints compile away.
+#ifdef GOLF_SCORE_TRACE
+
+constexpr size_t GolfScoreTraceCapacity = 256;
+constexpr uint16_t GolfScoreTraceNoArg = 0xFFFF;
+
+class GolfScoreTraceScope
+{
+private:
+    const char *name;
+
+public:
+    explicit GolfScoreTraceScope(const char *name, uint16_t arg = GolfScoreTraceNoArg);
+    ~GolfScoreTraceScope();
+
+    GolfScoreTraceScope(const GolfScoreTraceScope &) = delete;
+    GolfScoreTraceScope &operator=(const GolfScoreTraceScope &) = delete;
+};
+
+// Stamps the ring holds, at most GolfScoreTraceCapacity
+size_t golf_score_trace_count();
+void golf_score_trace_clear();
+// Writes the ring to trace.json, oldest stamp first
+bool golf_score_trace_dump();
+
+#define GOLF_SCORE_TRACE_SCOPE(name) GolfScoreTraceScope golf_score_trace_scope_(name)
+#define GOLF_SCORE_TRACE_SCOPE_ARG(name, arg) GolfScoreTraceScope golf_score_trace_scope_(name, arg)
+#define GOLF_SCORE_TRACE_DUMP() golf_score_trace_dump()
+
+#else
+
+#define GOLF_SCORE_TRACE_SCOPE(name) ((void)0)
+#define GOLF_SCORE_TRACE_SCOPE_ARG(name, arg) ((void)0)
+#define GOLF_SCORE_TRACE_DUMP() ((void)0)
+
+#endif
+
+// Every view switch goes through here so traces show which view was
+// entered and what its enter/exit callbacks cost
+inline void golf_score_switch_view(ViewDispatcher *viewDispatcher, uint32_t view)
+{
+    GOLF_SCORE_TRACE_SCOPE_ARG("view_switch", static_cast<uint16_t>(view));
+    view_dispatcher_switch_to_view(viewDispatcher, view);
+}
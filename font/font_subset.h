@@ -0,0 +1,124 @@
+#pragma once
+
+// Generated by tools/font_subset.py from font/font_source.h - do not edit by hand.
+// Character set:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+#include <stdint.h>
+
+/*
+  Fontname: -Misc-Fixed-Medium-R-Normal--6-60-75-75-C-40-ISO10646-1
+  Copyright: Public domain font.  Share and enjoy.
+  Glyphs: 191/919
+  BBX Build Mode: 0
+  Subset: 95/191 glyphs
+*/
+static const uint8_t u8g2_font_4x6_tf[] =
+    "_\0\2\2\3\3\2\4\4\4\6\0\377\5\377\5\377\0\351\1\323\2\266 \5\200\315\0!\6"
+    "\351\310\254\0\42\6\223\313$\25#\12\254\310\244\64T\32*\1$\11\263\307\245"
+    "\241GJ\0%\10\253\310d\324F\1&\11\254\310\305\24\253\230\2'\5\321\313\10(\7"
+    "\362\307\251f\0)\10\262\307\304T)\0*\7\253\310\244j5+\10\253\310\305\264b\2,"
+    "\6\222\307)\0-\5\213\312\14.\5\311\310\4/\7\253\310Ve\4\60\10\253\310UCU\0"
+    "\61\7\253\310%Y\15\62\7\253\310\65S\32\63\10\253\310\314\224\27\0\64\10\253"
+    "\310$5b\1\65\10\253\310\214\250\27\0\66\7\253\310M\325\2\67\10\253\310\314TF"
+    "\08\7\253\310\255\326\29\7\253\310\265\344\2:\6\341\310\304\0;\7\252\307e"
+    "\250\0<\7\253\310\246\272\0=\6\233\311\354\1>\7\253\310\344\252\4\77\10\253"
+    "\310\350\224a\2@\6\253\310-[A\10\253\310UC\251\0B\10\253\310\250\264\322\2C"
+    "\10\253\310U2U\0D\10\253\310\250d-\0E\10\253\310\214\250\342\0F\10\253\310"
+    "\214\250b\4G\10\253\310\315\244\222\0H\10\253\310$5\224\12I\7\253\310\254X"
+    "\15J\7\253\310\226\252\2K\10\253\310$\265\222\12L\7\253\310\304\346\0M\10"
+    "\253\310\244\61\224\12N\10\253\310\252\241$\0O\7\253\310UV\5P\10\253\310\250"
+    "\264b\4Q\7\263\307UV\35R\10\253\310\250\264\222\12S\7\253\310\355\274\0T\7"
+    "\253\310\254\330\2U\7\253\310$\327\10V\10\253\310$k\244\4W\10\253\310$5\206"
+    "\12X\10\253\310$\325R\1Y\10\253\310$UV\0Z\7\253\310\314T\16[\6\352\310\254J"
+    "\134\7\253\310\304\134\6]\6\252\310\250j^\5\223\313\65_\5\213\307\14`\6\322"
+    "\313\304\0a\7\243\310-\225\4b\10\253\310D\225\324\2c\6\243\310\315,d\10\253"
+    "\310\246\245\222\0e\6\243\310USf\10\253\310\246\264b\2g\10\253\307\255$\27\0"
+    "h\10\253\310D\225\254\0i\10\253\310e$\323\0j\10\263\307fX.\0k\10\253\310\304"
+    "\264\222\12l\7\253\310\310\326\0m\10\243\310\244\241T\0n\7\243\310\250d\5o\7"
+    "\243\310U\252\2p\10\253\307\250\264b\4q\10\253\307-\225d\0r\10\243\310\244"
+    "\25#\0s\7\243\310\215\274\0t\10\253\310\245\25s\0u\7\243\310$+\11v\7\243\310"
+    "$\253\2w\10\243\310$5T\0x\7\243\310\244\62\25y\10\253\307$\225\344\2z\7\243"
+    "\310\314\224\6{\10\263\307\246$\353\0|\6\351\310\14\1}\11\263\307\344\250b"
+    "\212\0~\7\224\313%\225\0\0\0\0\4\377\377";
+
+/*
+  Fontname: -Misc-Fixed-Medium-R-Normal--8-80-75-75-C-50-ISO10646-1
+  Copyright: Public domain font.  Share and enjoy.
+  Glyphs: 191/1426
+  BBX Build Mode: 0
+  Subset: 95/191 glyphs
+*/
+static const uint8_t u8g2_font_5x8_tf[] =
+    "_\0\2\2\3\4\3\4\4\5\10\0\377\6\377\6\0\1\32\2\61\3/ \5\0~\3!\7\61c3R\0\42\7"
+    "\233n\223\254\0#\15=bW\246\64T5T\231\22\0$\12=b\233W\275S\332\21%\10\253f\23"
+    "Sg\0&\12<b\27S\263j\246\0'\5\31o3(\7\262b\247\232\1)\10\262b\23S\245\0*\12,b"
+    "\23\223\32I\305\0+\12-b\233Q\34\62\243\10,\7\233^\247J\0-\6\14j3\2.\7\233^"
+    "\227V\2/\10\64b_\266\63\0\60\10\263bW\271*\0\61\7\263b\227dk2\12\64b\247bN*"
+    "\217\0\63\12\64b3b\324H&\5\64\12\64b\33U5bN\0\65\12\64b3\364F2)\0\66\12\64b"
+    "\247\362\212\62)\0\67\12\64b3r\314\61G\08\12\64b\247bRQ&\59\12\64b\247\242L;"
+    ")\0:\7\252b3\342\10;\10\263^g#U\2<\7\263b\233\312\134=\10\34f32\32\1>\10\263"
+    "b\223\313T\2\77\11\263b\327L\31&\0@\14E^+\243\134I%YC\5A\11\64b\247\242\34S"
+    "\6B\12\64b\263\342HQ\216\4C\11\64b\247\242.\223\2D\11\64b\263\242s$\0E\11\64"
+    "b3\364\312y\4F\11\64b3\364\312\65\0G\12\64b\247\242N3)\0H\11\64b\23\345\230f"
+    "\0I\7\263b\263bkJ\11\64b7sUF\0K\11\64b\23U\222\251\63L\10\64b\223\273G\0M\11"
+    "\64b\23\307\21\315\0N\11\64b\23\327Xg\0O\11\64b\247\242\63)\0P\12\64b\263"
+    "\242\34)g\0Q\11<^\247\242\134n\24R\12\64b\263\242\34)\312\0S\12\64b\247b\312"
+    "\250L\12T\10\263b\263b\27\0U\10\64b\23=\223\2V\11\64b\23\235I*\0W\11\64b\23"
+    "\315q\304\0X\12\64b\23e\222*\312\0Y\13\65b\223u\252\63\312(\2Z\11\64b3rl\217"
+    "\0[\7\263b3bs\134\12\64b\223\63\312(\243\34]\7\263b3\233#^\6\223r\327\0_\6"
+    "\14^3\2`\6\222r\23\3a\10$b7\242L\3b\12\64b\223\363\212r$\0c\7\243b7\263\0d"
+    "\11\64b_\215(\323\0e\10$b\247\322\310\12f\11\64b[\225\63G\0g\11,^\247b\332I"
+    "\1h\11\64b\223\363\212f\0i\10\263b\227\221\254\6j\11\273^\233a\251*\0k\11\64"
+    "b\223\313\221\242\14l\7\263b#\273\6m\11%b\243Z*\251\2n\7$b\263\242\31o\10$b"
+    "\247\242L\12p\11,^\263\342H9\3q\10,^7b\332\5r\10$b\223\222\235\1s\7\243b7"
+    "\362\2t\12\64b\227\343\314)&\0u\7$b\23\315\64v\7\243b\223\254\12w\11%b\223UR"
+    "]\0x\10$b\23\223T1y\12,^\23e\32\61)\0z\10$b3b9\2{\13<b\253\62J\32\305\214\4|"
+    "\5\61cs}\14<b\243Q\314He\224$\0~\7\24r\227T\2\0\0\0\4\377\377";
+
+/*
+  Fontname: -Misc-Fixed-Medium-R-Normal--10-100-75-75-C-60-ISO10646-1
+  Copyright: Public domain terminal emulator font.  Share and enjoy.
+  Glyphs: 191/1597
+  BBX Build Mode: 0
+  Subset: 95/191 glyphs
+*/
+static const uint8_t u8g2_font_6x10_tf[] =
+    "_\0\2\2\3\4\3\5\4\6\12\0\376\7\376\7\0\1B\2\222\3\303 \5\0b\7!\79Cg\250\0\42"
+    "\7\233R'Y\1#\15=B\257Li\250j\250\62%\0$\13=B7\257z\247\264#\0%\13=B/\252\356"
+    "\252%\23\0&\14=B/\247\230r\225dT\1'\5\31Sg(\10\273B7\225u\1)\10\273B'\227U"
+    "\11*\12-F'\247j\250v\0+\12-F7\2438dF\21,\7\233>O\225\0-\6\15Ng\10.\7\233>/"
+    "\255\4/\13=B\37e\224\273QF\0\60\12=B7\247\332Nu\4\61\14=B7\313\224QF\31\305!"
+    "2\14=Bo\345\214\242\314\31\15\1\63\14=Bgh\224\263\206:-\0\64\14=B\77\313T"
+    "\246\241\63J\0\65\13=B\347F\311\314H\247\5\66\13=BW\346\214\222\251\323\2\67"
+    "\14=Bgh\224\63\312\65\312\08\13=Boe\235V\326i\19\14=Boe\251TF9J\0:\12\273>/"
+    "\255\14\323J\0;\11\273>/\255\14U\11<\12\274B\77\266QF\31\5=\10\35Jgh8\4>\13"
+    "\274B'\243\214\62\212m\0\77\12=Bo\345\66\312t\4@\13=Boe\271\222\225\341\2A"
+    "\13=B7\247Z\217\221u\0B\14=Bg\304*\246Y\305\241\0C\14=Boe\215\62\312(\247\5D"
+    "\15=Bg\304*\246\230b\212C\1E\14=B\347F\31\215\224QFCF\15=B\347F\31\215\224QF"
+    "\31\1G\14=Boe\215\62\212;-\0H\11=B'\333cd;I\10\273Bg\305\256\1J\14=Bwg\224QF"
+    "e\224\0K\13=B'\313T\352\24\253\34L\16=B'\243\214\62\312(\243\214\206\0M\12=B"
+    "'\353\265\222\266\3N\12=B'\353\251\222\334:O\11=Boe\357\264\0P\15=Bg\244\254"
+    "\207\312(\243\214\0Q\12E>oe\257j\303\0R\13=Bg\244\254\207*\253\34S\13=Boe\15"
+    "\67\324i\1T\16=Bg\310\214\62\312(\243\214\42\0U\10=B'\373N\13V\13=B'\333\251"
+    "L1\345\10W\12=B'\273\222Jw\0X\12=B'\353TW\265\16Y\14=B'\353Tg\224QF\21Z\12=B"
+    "gh\224\273\321\20[\10\273Bg\304\316\1\134\15=B'\243\14\63\314\60\303\214\2]"
+    "\10\273Bgv\216\0^\7\35R7\247:_\6\15>g\10`\6\22['\6a\12-Bo\303\64t\32\1b\14=B"
+    "'\243\214\222\251\247R\0c\12-Boe\215rZ\0d\13=B\37e\224\314-\225\12e\12-Bo"
+    "\345\61\62\134\0f\14=BWVy\304\214\62\312\0g\14=:oh\235FF:-\0h\13=B'\243\214"
+    "\222\251\355\0i\10\273B/#\331\32j\13\314:\77c]K\231\24\0k\14=B'\243\214\262L"
+    "\263\312\1l\7\273BG\366\32m\12-BG\265TRI\7n\10-B'\231\332\16o\11-Boe;-\0p\14"
+    "=:'\231z*\225QF\0q\13=:\317\334R\251\214\62\12r\13-B'\231\32e\224\21\0s\12-B"
+    "oe\270\341P\0t\15=B/\243<bF\31\305\250\0u\10-B';\225\12v\12-B'\353T\246\34\1"
+    "w\11-B'[Iu\1x\11-B'\247\272\252\3y\13=:'\233Je\244\323\2z\10-Bg\350\366\20{"
+    "\13\274BWe\224\64\212\31\11|\69C\347\10}\14\274BG\243\230\221\312(I\0~\11\35"
+    "R/\252$\23\0\0\0\0\4\377\377";
+
+/*
+  Fontname: -Misc-Fixed-Medium-R-Normal--15-140-75-75-C-90-ISO10646-1
+  Copyright: Public domain font.  Share and enjoy.
+  Glyphs: 191/4777
+  BBX Build Mode: 0
+  Subset: 0/191 glyphs (FONT_SIZE_XLARGE unused)
+*/
+static const uint8_t u8g2_font_9x15_tf[] =
+    "\0\0\3\2\4\4\4\5\5\11\17\0\375\12\375\13\377\0\0\0\0\0\2\0\0\0\4\377\377";
@@ -3,13 +3,18 @@
 #include <cstddef>
 #include <cstdint>
 
-constexpr std::size_t GolfScoreMaxPlayers = 4;
-constexpr std::size_t GolfScoreMaxHoles = 18;
+constexpr std::size_t GolfScoreMaxPlayers = 32;
+constexpr std::size_t GolfScoreMaxHoles = 36; // Largest course; rounds are sized to the holes played
 constexpr std::size_t GolfScoreMaxNameLength = 16;
 
-constexpr std::size_t GolfScoreMaxCourses = 5;
+constexpr std::size_t GolfScoreMaxCourses = 1000; // Records in the on-disk course library
 constexpr std::size_t GolfScoreCourseNameLength = 16;
 
 constexpr uint8_t GolfScoreMinPar = 2;
 constexpr uint8_t GolfScoreMaxPar = 7;
 constexpr uint8_t GolfScoreDefaultPar = 4;
+
+constexpr int8_t GolfScoreMinHandicap = -10; // Plus handicaps give strokes back
+constexpr int8_t GolfScoreMaxHandicap = 54;
+
+constexpr std::size_t GolfScoreUndoDepth = 32; // Hole edits kept for undo/redo
@@ -0,0 +1,826 @@
+#include "history/history.hpp"
+#include "app.hpp"
+#include "debug/memory_probe.hpp"
+#include "debug/trace.hpp"
+#include "debug/latency.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    constexpr size_t KeyFieldCount = 4; // Date,Time,Course,HoleCount identify a round
+    constexpr size_t RowFieldCount = 7; // ...,Player,Total,Relative
+    constexpr size_t DescribeRows = GolfScoreMaxPlayers + GolfScoreMaxTeams; // Most rows a real round has
+
+    // Splits a CSV row in place. Returns the number of fields found (at most max).
+    size_t split_fields(char *line, char **fields, size_t max)
+    {
+        size_t count = 0;
+        char *cursor = line;
+        while (count < max)
+        {
+            fields[count++] = cursor;
+            char *comma = strchr(cursor, ',');
+            if (!comma)
+            {
+                break;
+            }
+            *comma = '\0';
+            cursor = comma + 1;
+        }
+        return count;
+    }
+
+    // Length of the round key prefix (up to the fourth comma), or 0 for header/short rows.
+    size_t key_length(const char *line)
+    {
+        if (strncmp(line, "Date,", 5) == 0)
+        {
+            return 0;
+        }
+
+        size_t commas = 0;
+        for (size_t i = 0; line[i] != '\0'; ++i)
+        {
+            if (line[i] == ',' && ++commas == KeyFieldCount)
+            {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    void copy_field(char *out, size_t size, const char *in)
+    {
+        snprintf(out, size, "%s", in ? in : "");
+    }
+}
+
+GolfScoreRoundLog::~GolfScoreRoundLog()
+{
+    close();
+}
+
+bool GolfScoreRoundLog::open()
+{
+    GolfScoreLatencyScope timing(GolfScoreLatencyHistoryOpen);
+    close();
+
+    storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    if (!storage)
+    {
+        resetIndex();
+        return false;
+    }
+
+    file = storage_file_alloc(storage);
+    if (!file)
+    {
+        close();
+        resetIndex();
+        return false;
+    }
+
+    char path[256];
+    GolfScoreApp::roundHistoryPath(path, sizeof(path));
+    if (!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING))
+    {
+        close();
+        resetIndex();
+        return false;
+    }
+
+    uint32_t size = static_cast<uint32_t>(storage_file_size(file));
+    bufferLength = 0;
+    bufferPos = 0;
+    bufferOffset = 0;
+
+    // Appends are indexed from the newest known round, which may have gained
+    // rows; any other change indexes the whole file again
+    uint32_t from = 0;
+    if (!indexValid(size))
+    {
+        resetIndex();
+    }
+    else if (size == indexedSize)
+    {
+        return true;
+    }
+    else
+    {
+        from = lastStart;
+        --rounds;
+        if (checkpointCount > 0 && rounds % stride == 0)
+        {
+            --checkpointCount;
+        }
+        cacheCount = 0;
+    }
+
+    if (!seek(from))
+    {
+        close();
+        resetIndex();
+        return false;
+    }
+
+    // One pass to count rounds and drop a checkpoint every `stride` rounds
+    char line[LineLength];
+    uint32_t lineStart = 0;
+    lastKeyLength = 0;
+    while (readLine(line, sizeof(line), lineStart))
+    {
+        size_t length = key_length(line);
+        if (length == 0)
+        {
+            continue;
+        }
+
+        if (length != lastKeyLength || strncmp(line, lastKey, length) != 0)
+        {
+            addCheckpoint(rounds, lineStart);
+            ++rounds;
+            lastStart = lineStart;
+            memcpy(lastKey, line, length);
+            lastKeyLength = length;
+        }
+    }
+
+    indexedSize = size;
+    return true;
+}
+
+void GolfScoreRoundLog::close()
+{
+    if (file)
+    {
+        if (storage_file_is_open(file))
+        {
+            storage_file_close(file);
+        }
+        storage_file_free(file);
+        file = nullptr;
+    }
+
+    if (storage)
+    {
+        furi_record_close(RECORD_STORAGE);
+        storage = nullptr;
+    }
+}
+
+// The index still describes the file if it has not shrunk and the newest
+// indexed round still starts where it did
+bool GolfScoreRoundLog::indexValid(uint32_t size)
+{
+    if (rounds == 0 || size < indexedSize)
+    {
+        return false;
+    }
+
+    char line[LineLength];
+    uint32_t lineStart = 0;
+    return seek(lastStart) && readLine(line, sizeof(line), lineStart) &&
+           key_length(line) == lastKeyLength && strncmp(line, lastKey, lastKeyLength) == 0;
+}
+
+void GolfScoreRoundLog::resetIndex()
+{
+    rounds = 0;
+    stride = 1;
+    checkpointCount = 0;
+    cacheCount = 0;
+    cacheClock = 0;
+    indexedSize = 0;
+    lastStart = 0;
+    lastKeyLength = 0;
+}
+
+bool GolfScoreRoundLog::seek(uint32_t offset)
+{
+    if (!file)
+    {
+        return false;
+    }
+
+    // Stepping to the next round usually lands inside the current buffer
+    if (offset >= bufferOffset && offset <= bufferOffset + bufferLength)
+    {
+        bufferPos = offset - bufferOffset;
+        return true;
+    }
+
+    if (!storage_file_seek(file, offset, true))
+    {
+        return false;
+    }
+
+    bufferOffset = offset;
+    bufferLength = 0;
+    bufferPos = 0;
+    return true;
+}
+
+bool GolfScoreRoundLog::readLine(char *line, size_t size, uint32_t &lineStart)
+{
+    lineStart = tell();
+    size_t length = 0;
+    bool any = false;
+
+    while (true)
+    {
+        if (bufferPos >= bufferLength)
+        {
+            bufferOffset += static_cast<uint32_t>(bufferLength);
+            bufferPos = 0;
+            bufferLength = file ? storage_file_read(file, buffer, sizeof(buffer)) : 0;
+            if (bufferLength == 0)
+            {
+                break;
+            }
+        }
+
+        char ch = buffer[bufferPos++];
+        any = true;
+        if (ch == '\n')
+        {
+            break;
+        }
+        if (ch != '\r' && length + 1 < size)
+        {
+            line[length++] = ch;
+        }
+    }
+
+    line[length] = '\0';
+    return any;
+}
+
+// Start of the line ending just before `offset`, which is a line start.
+// Reads backwards a buffer at a time.
+bool GolfScoreRoundLog::lineBefore(uint32_t offset, uint32_t &lineStart)
+{
+    if (!file || offset == 0)
+    {
+        return false;
+    }
+
+    // offset - 1 is the newline that ends the line
+    uint32_t cursor = offset - 1;
+    while (cursor > 0)
+    {
+        uint32_t chunk = cursor > sizeof(buffer) ? cursor - static_cast<uint32_t>(sizeof(buffer)) : 0;
+        if (chunk < bufferOffset || cursor > bufferOffset + bufferLength)
+        {
+            if (!storage_file_seek(file, chunk, true))
+            {
+                return false;
+            }
+            bufferOffset = chunk;
+            bufferPos = 0;
+            bufferLength = storage_file_read(file, buffer, sizeof(buffer));
+            if (bufferOffset + bufferLength < cursor)
+            {
+                return false;
+            }
+        }
+
+        for (uint32_t at = cursor; at > chunk; --at)
+        {
+            if (buffer[at - 1 - bufferOffset] == '\n')
+            {
+                lineStart = at;
+                return true;
+            }
+        }
+        cursor = chunk;
+    }
+
+    lineStart = 0;
+    return true;
+}
+
+// Start of the round whose rows end before `offset`, a round start: the
+// rows sharing the key of the last keyed row before it
+bool GolfScoreRoundLog::roundStartBefore(uint32_t offset, uint32_t &start)
+{
+    char line[LineLength];
+    char key[LineLength] = {0};
+    size_t keyLength = 0;
+    uint32_t lineStart = offset;
+    uint32_t ignored = 0;
+    bool found = false;
+
+    while (lineBefore(lineStart, lineStart))
+    {
+        if (!seek(lineStart) || !readLine(line, sizeof(line), ignored))
+        {
+            return false;
+        }
+
+        size_t length = key_length(line);
+        if (length == 0)
+        {
+            continue;
+        }
+
+        if (keyLength == 0)
+        {
+            memcpy(key, line, length);
+            keyLength = length;
+        }
+        else if (length != keyLength || strncmp(line, key, length) != 0)
+        {
+            break;
+        }
+        start = lineStart;
+        found = true;
+    }
+
+    return found;
+}
+
+bool GolfScoreRoundLog::parseRound(uint32_t offset, uint32_t index, GolfScoreHistoryRecord &out)
+{
+    if (!seek(offset))
+    {
+        return false;
+    }
+
+    out = GolfScoreHistoryRecord{};
+    out.index = index;
+    out.start = offset;
+    out.end = offset;
+
+    char line[LineLength];
+    char key[LineLength] = {0};
+    size_t keyLength = 0;
+    uint32_t lineStart = 0;
+
+    while (readLine(line, sizeof(line), lineStart))
+    {
+        size_t length = key_length(line);
+        if (length == 0)
+        {
+            if (keyLength == 0)
+            {
+                out.start = tell();
+            }
+            continue;
+        }
+
+        if (keyLength == 0)
+        {
+            memcpy(key, line, length);
+            keyLength = length;
+        }
+        else if (length != keyLength || strncmp(line, key, length) != 0)
+        {
+            break;
+        }
+
+        char *fields[RowFieldCount] = {};
+        if (split_fields(line, fields, RowFieldCount) < RowFieldCount)
+        {
+            out.end = tell();
+            continue;
+        }
+
+        if (out.playerCount == 0 && fields[4][0] != GolfScoreHistoryTeamMarker)
+        {
+            copy_field(out.date.data(), out.date.size(), fields[0]);
+            copy_field(out.time.data(), out.time.size(), fields[1]);
+            copy_field(out.course.data(), out.course.size(), fields[2]);
+            out.holeCount = static_cast<uint8_t>(strtoul(fields[3], nullptr, 10));
+        }
+
+        // Team rows follow the players; they are shown but are not players
+        if (fields[4][0] == GolfScoreHistoryTeamMarker)
+        {
+            out.end = tell();
+            continue;
+        }
+
+        uint16_t total = static_cast<uint16_t>(strtoul(fields[5], nullptr, 10));
+        if (total > 0 && (out.leaderTotal == 0 || total < out.leaderTotal))
+        {
+            out.leaderTotal = total;
+            copy_field(out.leader.data(), out.leader.size(), fields[4]);
+        }
+
+        if (out.playerCount < UINT8_MAX)
+        {
+            ++out.playerCount;
+        }
+        out.end = tell();
+    }
+
+    return keyLength > 0;
+}
+
+void GolfScoreRoundLog::addCheckpoint(uint32_t index, uint32_t offset)
+{
+    if (index % stride != 0)
+    {
+        return;
+    }
+
+    if (checkpointCount == MaxCheckpoints)
+    {
+        for (size_t i = 0; i < MaxCheckpoints / 2; ++i)
+        {
+            checkpoints[i] = checkpoints[i * 2];
+        }
+        checkpointCount = MaxCheckpoints / 2;
+        stride *= 2;
+
+        if (index % stride != 0)
+        {
+            return;
+        }
+    }
+
+    checkpoints[checkpointCount++] = offset;
+}
+
+const GolfScoreHistoryRecord *GolfScoreRoundLog::cacheFind(uint32_t index)
+{
+    for (size_t i = 0; i < cacheCount; ++i)
+    {
+        if (cache[i].index == index)
+        {
+            cacheAge[i] = ++cacheClock;
+            return &cache[i];
+        }
+    }
+    return nullptr;
+}
+
+void GolfScoreRoundLog::cacheInsert(const GolfScoreHistoryRecord &record)
+{
+    size_t slot = cacheCount;
+    for (size_t i = 0; i < cacheCount; ++i)
+    {
+        if (cache[i].index == record.index)
+        {
+            slot = i;
+            break;
+        }
+    }
+
+    if (slot == cacheCount)
+    {
+        if (cacheCount < CacheSize)
+        {
+            ++cacheCount;
+        }
+        else
+        {
+            slot = 0;
+            for (size_t i = 1; i < CacheSize; ++i)
+            {
+                if (cacheAge[i] < cacheAge[slot])
+                {
+                    slot = i;
+                }
+            }
+        }
+    }
+
+    cache[slot] = record;
+    cacheAge[slot] = ++cacheClock;
+}
+
+bool GolfScoreRoundLog::fetch(uint32_t index, GolfScoreHistoryRecord &out)
+{
+    if (index >= rounds || checkpointCount == 0)
+    {
+        return false;
+    }
+
+    const GolfScoreHistoryRecord *hit = cacheFind(index);
+    if (hit)
+    {
+        out = *hit;
+        return true;
+    }
+
+    GolfScoreLatencyScope timing(GolfScoreLatencyHistoryRead);
+
+    // The newest round is the list's first row
+    if (index + 1 == rounds && parseRound(lastStart, index, out))
+    {
+        cacheInsert(out);
+        return true;
+    }
+
+    // Neighbours of a cached round: the next starts where it ends, and the
+    // previous (the row below it in the newest-first list) is found by
+    // reading back from its start
+    const GolfScoreHistoryRecord *neighbour = index > 0 ? cacheFind(index - 1) : nullptr;
+    if (neighbour && parseRound(neighbour->end, index, out))
+    {
+        cacheInsert(out);
+        return true;
+    }
+    neighbour = cacheFind(index + 1);
+    uint32_t start = 0;
+    if (neighbour && roundStartBefore(neighbour->start, start) && parseRound(start, index, out))
+    {
+        cacheInsert(out);
+        return true;
+    }
+
+    // Otherwise walk forward from the nearest checkpoint, caching every round
+    // on the way so stepping back through them stays cheap
+    size_t checkpoint = std::min<size_t>(index / stride, checkpointCount - 1);
+    uint32_t current = static_cast<uint32_t>(checkpoint) * stride;
+    uint32_t offset = checkpoints[checkpoint];
+    GolfScoreHistoryRecord record;
+    while (current <= index)
+    {
+        if (!parseRound(offset, current, record))
+        {
+            return false;
+        }
+        cacheInsert(record);
+        offset = record.end;
+        ++current;
+    }
+
+    out = record;
+    return true;
+}
+
+bool GolfScoreRoundLog::describe(const GolfScoreHistoryRecord &record, FuriString *out)
+{
+    if (!out || !seek(record.start))
+    {
+        return false;
+    }
+
+    furi_string_printf(out, "%s %s\n%s (%u holes)\n", record.date.data(), record.time.data(), record.course.data(), static_cast<unsigned>(record.holeCount));
+
+    // A damaged log can repeat one round's key for any number of rows
+    char line[LineLength];
+    uint32_t lineStart = 0;
+    size_t rows = 0;
+    while (tell() < record.end && rows < DescribeRows && readLine(line, sizeof(line), lineStart))
+    {
+        char *fields[RowFieldCount] = {};
+        if (key_length(line) == 0 || split_fields(line, fields, RowFieldCount) < RowFieldCount)
+        {
+            continue;
+        }
+        const char *name = fields[4][0] == GolfScoreHistoryTeamMarker ? fields[4] + 1 : fields[4];
+        furi_string_cat_printf(out, "%s %s (%s)\n", name, fields[5], fields[6]);
+        ++rows;
+    }
+
+    return true;
+}
+
+GolfScoreHistory::GolfScoreHistory(ViewDispatcher **viewDispatcher) : viewDispatcherRef(viewDispatcher)
+{
+}
+
+GolfScoreHistory::~GolfScoreHistory()
+{
+    log.close();
+
+    if (listView && viewDispatcherRef && *viewDispatcherRef)
+    {
+        view_dispatcher_remove_view(*viewDispatcherRef, GolfScoreViewHistory);
+        view_free(listView);
+        listView = nullptr;
+    }
+
+    if (detailWidget && viewDispatcherRef && *viewDispatcherRef)
+    {
+        view_dispatcher_remove_view(*viewDispatcherRef, GolfScoreViewHistoryDetail);
+        widget_free(detailWidget);
+        detailWidget = nullptr;
+    }
+}
+
+uint32_t GolfScoreHistory::callbackToSettings(void *context)
+{
+    auto *history = static_cast<GolfScoreHistory *>(context);
+    if (history)
+    {
+        history->log.close();
+    }
+    return GolfScoreViewSettings;
+}
+
+uint32_t GolfScoreHistory::callbackToList(void *context)
+{
+    UNUSED(context);
+    return GolfScoreViewHistory;
+}
+
+bool GolfScoreHistory::show()
+{
+    GOLF_SCORE_MEMORY_PROBE("history_view");
+    if (!viewDispatcherRef || !*viewDispatcherRef)
+    {
+        return false;
+    }
+
+    if (!listView)
+    {
+        if (!easy_flipper_set_view(&listView, GolfScoreViewHistory, listDraw, listInput, callbackToSettings, viewDispatcherRef, this))
+        {
+            listView = nullptr;
+            return false;
+        }
+        view_allocate_model(listView, ViewModelTypeLocking, sizeof(ListModel));
+    }
+
+    log.open();
+    selected = 0;
+    top = 0;
+    refreshWindow();
+
+    golf_score_switch_view(*viewDispatcherRef, GolfScoreViewHistory);
+    return true;
+}
+
+uint32_t GolfScoreHistory::roundForRow(uint32_t row) const
+{
+    // Newest round first
+    return log.roundCount() - 1 - row;
+}
+
+void GolfScoreHistory::refreshWindow()
+{
+    if (!listView)
+    {
+        return;
+    }
+
+    uint32_t total = log.roundCount();
+    Row rows[VisibleRows];
+    uint8_t rowCount = 0;
+
+    for (uint8_t i = 0; i < VisibleRows && top + i < total; ++i)
+    {
+        GolfScoreHistoryRecord record;
+        if (!log.fetch(roundForRow(top + i), record))
+        {
+            break;
+        }
+
+        const char *date = strlen(record.date.data()) >= 10 ? record.date.data() + 5 : record.date.data();
+        snprintf(rows[i].label, sizeof(rows[i].label), "%s %-8.8s %.6s %u", date, record.course.data(), record.leader.data(), static_cast<unsigned>(record.leaderTotal));
+        ++rowCount;
+    }
+
+    auto *model = static_cast<ListModel *>(view_get_model(listView));
+    model->total = total;
+    model->selected = selected;
+    model->top = top;
+    model->rowCount = rowCount;
+    memcpy(model->rows, rows, sizeof(Row) * rowCount);
+    view_commit_model(listView, true);
+}
+
+void GolfScoreHistory::moveSelection(int32_t delta)
+{
+    uint32_t total = log.roundCount();
+    if (total == 0)
+    {
+        return;
+    }
+
+    int64_t next = static_cast<int64_t>(selected) + delta;
+    next = std::clamp<int64_t>(next, 0, static_cast<int64_t>(total) - 1);
+    if (static_cast<uint32_t>(next) == selected)
+    {
+        return;
+    }
+
+    selected = static_cast<uint32_t>(next);
+    if (selected < top)
+    {
+        top = selected;
+    }
+    else if (selected >= top + VisibleRows)
+    {
+        top = selected - VisibleRows + 1;
+    }
+
+    refreshWindow();
+}
+
+void GolfScoreHistory::showDetail()
+{
+    GOLF_SCORE_MEMORY_PROBE("history_detail");
+    if (log.roundCount() == 0 || !viewDispatcherRef || !*viewDispatcherRef)
+    {
+        return;
+    }
+
+    if (!detailWidget && !easy_flipper_set_widget(&detailWidget, GolfScoreViewHistoryDetail, nullptr, callbackToList, viewDispatcherRef))
+    {
+        detailWidget = nullptr;
+        return;
+    }
+
+    GolfScoreHistoryRecord record;
+    if (!log.fetch(roundForRow(selected), record))
+    {
+        return;
+    }
+
+    FuriString *text = furi_string_alloc();
+    log.describe(record, text);
+    widget_reset(detailWidget);
+    widget_add_text_scroll_element(detailWidget, 0, 0, 128, 64, furi_string_get_cstr(text));
+    furi_string_free(text);
+
+    golf_score_switch_view(*viewDispatcherRef, GolfScoreViewHistoryDetail);
+}
+
+void GolfScoreHistory::listDraw(Canvas *canvas, void *model)
+{
+    auto *list = static_cast<ListModel *>(model);
+    if (!canvas || !list)
+    {
+        return;
+    }
+
+    canvas_clear(canvas);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_set_font_custom(canvas, FONT_SIZE_SMALL);
+
+    if (list->total == 0)
+    {
+        canvas_draw_str(canvas, 2, 7, "History");
+        canvas_set_font_custom(canvas, FONT_SIZE_MEDIUM);
+        canvas_draw_str(canvas, 2, 30, "No saved rounds yet.");
+        return;
+    }
+
+    char header[32];
+    snprintf(header, sizeof(header), "History %lu/%lu", static_cast<unsigned long>(list->selected + 1), static_cast<unsigned long>(list->total));
+    canvas_draw_str(canvas, 2, 7, header);
+
+    canvas_set_font_custom(canvas, FONT_SIZE_MEDIUM);
+    for (uint8_t i = 0; i < list->rowCount; ++i)
+    {
+        uint8_t y = static_cast<uint8_t>(18 + i * 10);
+        bool highlight = list->top + i == list->selected;
+        if (highlight)
+        {
+            canvas_draw_box(canvas, 0, y - 8, 128, 10);
+            canvas_set_color(canvas, ColorWhite);
+        }
+        canvas_draw_str(canvas, 2, y, list->rows[i].label);
+        if (highlight)
+        {
+            canvas_set_color(canvas, ColorBlack);
+        }
+    }
+}
+
+bool GolfScoreHistory::listInput(InputEvent *event, void *context)
+{
+    auto *history = static_cast<GolfScoreHistory *>(context);
+    if (!history || !event)
+    {
+        return false;
+    }
+
+    if (event->type != InputTypeShort && event->type != InputTypeRepeat)
+    {
+        return false;
+    }
+
+    switch (event->key)
+    {
+    case InputKeyUp:
+        history->moveSelection(-1);
+        return true;
+    case InputKeyDown:
+        history->moveSelection(1);
+        return true;
+    case InputKeyLeft:
+        history->moveSelection(-static_cast<int32_t>(VisibleRows));
+        return true;
+    case InputKeyRight:
+        history->moveSelection(VisibleRows);
+        return true;
+    case InputKeyOk:
+        if (event->type == InputTypeShort)
+        {
+            history->showDetail();
+        }
+        return true;
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "easy_flipper/easy_flipper.h"
+#include "golf_score_config.hpp"
+
+#include <storage/storage.h>
+
+// Player field prefix for team rows in rounds.csv; player names never start
+// with it (the export blanks it out)
+constexpr char GolfScoreHistoryTeamMarker = '*';
+
+// One saved round as listed in the history view, decoded from the rows of
+// rounds.csv that share a Date,Time,Course,HoleCount key.
+struct GolfScoreHistoryRecord
+{
+    uint32_t index = 0;
+    uint32_t start = 0; // File offset of the round's first row
+    uint32_t end = 0;   // File offset just past the round's last row
+    std::array<char, 11> date{};
+    std::array<char, 6> time{};
+    std::array<char, GolfScoreCourseNameLength> course{};
+    std::array<char, GolfScoreMaxNameLength> leader{};
+    uint16_t leaderTotal = 0;
+    uint8_t holeCount = 0;
+    uint8_t playerCount = 0;
+};
+
+// Sequential reader over rounds.csv. Memory use is fixed regardless of the
+// log size: a sparse table of round start offsets (the stride doubles when it
+// fills) and a small LRU of decoded records. Neighbours of a cached round are
+// found from its offsets, reading backwards for older rounds, so stepping
+// through the list costs one round's rows. The index outlives close(): the
+// next open() reuses it while rounds.csv is unchanged and only indexes
+// appended rounds when it grew.
+class GolfScoreRoundLog
+{
+private:
+    static constexpr size_t MaxCheckpoints = 128;
+    static constexpr size_t CacheSize = 16;
+    static constexpr size_t LineLength = 96;
+
+    Storage *storage = nullptr;
+    File *file = nullptr;
+    char buffer[128];
+    size_t bufferLength = 0;
+    size_t bufferPos = 0;
+    uint32_t bufferOffset = 0;
+
+    uint32_t rounds = 0;
+    uint32_t stride = 1;
+    std::array<uint32_t, MaxCheckpoints> checkpoints{};
+    size_t checkpointCount = 0;
+    uint32_t indexedSize = 0; // File size the index covers
+    uint32_t lastStart = 0;   // Offset of the newest round
+    char lastKey[LineLength] = {0};
+    size_t lastKeyLength = 0;
+
+    std::array<GolfScoreHistoryRecord, CacheSize> cache{};
+    std::array<uint32_t, CacheSize> cacheAge{};
+    size_t cacheCount = 0;
+    uint32_t cacheClock = 0;
+
+    bool seek(uint32_t offset);
+    uint32_t tell() const { return bufferOffset + static_cast<uint32_t>(bufferPos); }
+    bool readLine(char *line, size_t size, uint32_t &lineStart);
+    bool lineBefore(uint32_t offset, uint32_t &lineStart);
+    bool roundStartBefore(uint32_t offset, uint32_t &start);
+    bool parseRound(uint32_t offset, uint32_t index, GolfScoreHistoryRecord &out);
+    bool indexValid(uint32_t size);
+    void resetIndex();
+    void addCheckpoint(uint32_t index, uint32_t offset);
+    const GolfScoreHistoryRecord *cacheFind(uint32_t index);
+    void cacheInsert(const GolfScoreHistoryRecord &record);
+
+public:
+    GolfScoreRoundLog() = default;
+    ~GolfScoreRoundLog();
+
+    bool open();
+    void close();
+    uint32_t roundCount() const { return rounds; }
+    bool fetch(uint32_t index, GolfScoreHistoryRecord &out);
+    bool describe(const GolfScoreHistoryRecord &record, FuriString *out);
+};
+
+class GolfScoreHistory
+{
+private:
+    static constexpr uint8_t VisibleRows = 5;
+
+    struct Row
+    {
+        char label[32];
+    };
+
+    struct ListModel
+    {
+        uint32_t total;
+        uint32_t selected;
+        uint32_t top;
+        uint8_t rowCount;
+        Row rows[VisibleRows];
+    };
+
+    ViewDispatcher **viewDispatcherRef;
+    View *listView = nullptr;
+    Widget *detailWidget = nullptr;
+    GolfScoreRoundLog log;
+    uint32_t selected = 0;
+    uint32_t top = 0;
+
+    static uint32_t callbackToSettings(void *context);
+    static uint32_t callbackToList(void *context);
+    static void listDraw(Canvas *canvas, void *model);
+    static bool listInput(InputEvent *event, void *context);
+    void moveSelection(int32_t delta);
+    void refreshWindow();
+    void showDetail();
+    uint32_t roundForRow(uint32_t row) const;
+
+public:
+    GolfScoreHistory(ViewDispatcher **viewDispatcher);
+    ~GolfScoreHistory();
+
+    bool show();
+};
@@ -0,0 +1,250 @@
+// Microbenchmarks for the scoring, persistence and history hot paths.
+//
+// Prints one CSV row per benchmark on stdout:
+//
+//   benchmark,log_rounds,iterations,ns_per_op,sd_us,opens,writes,bytes_written,blocks_written,reads,bytes_read,allocs,alloc_bytes
+//
+// Everything after ns_per_op is a per-operation average of the shim's
+// storage and operator new counters. log_rounds is the size of rounds.csv
+// for the history benchmarks and 0 elsewhere. --sd runs storage behind the
+// shim's Flipper SD card latency model, which fills in sd_us (simulated
+// card time) and blocks_written. --quick skips the 100,000-round log.
+
+#include "app.hpp"
+#include "common/host_access.hpp"
+#include "history/history.hpp"
+#include "host_shim.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    constexpr uint8_t Players = 4;
+    constexpr uint8_t Holes = 18;
+
+    volatile uint32_t sink = 0;
+
+    template <typename Body>
+    void run(const char *name, uint32_t rounds, uint32_t iterations, Body &&body)
+    {
+        host_storage_reset_stats();
+        host_alloc_reset_stats();
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            body(i);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const HostStorageStats &io = *host_storage_stats();
+        const HostAllocStats &heap = *host_alloc_stats();
+        double count = iterations;
+        printf("%s,%u,%u,%.1f,%.1f,%.2f,%.2f,%.1f,%.2f,%.2f,%.1f,%.2f,%.1f\n",
+               name,
+               static_cast<unsigned>(rounds),
+               static_cast<unsigned>(iterations),
+               std::chrono::duration<double, std::nano>(elapsed).count() / count,
+               io.busyUs / count,
+               io.opens / count,
+               io.writes / count,
+               io.bytesWritten / count,
+               io.blocksWritten / count,
+               io.reads / count,
+               io.bytesRead / count,
+               heap.allocations / count,
+               heap.bytes / count);
+        fflush(stdout);
+    }
+
+    // Each exported round needs its own minute, or the reader merges it
+    // with the previous one
+    void nextMinute(DateTime &now)
+    {
+        if (++now.minute < 60)
+        {
+            return;
+        }
+        now.minute = 0;
+        if (++now.hour < 24)
+        {
+            return;
+        }
+        now.hour = 0;
+        if (++now.day <= 28)
+        {
+            return;
+        }
+        now.day = 1;
+        if (++now.month <= 12)
+        {
+            return;
+        }
+        now.month = 1;
+        ++now.year;
+    }
+
+    uint64_t historySize()
+    {
+        char path[256];
+        GolfScoreApp::roundHistoryPath(path, sizeof(path));
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        uint64_t size = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) ? storage_file_size(file) : 0;
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+        return size;
+    }
+
+    void truncateHistory(uint64_t size)
+    {
+        char path[256];
+        GolfScoreApp::roundHistoryPath(path, sizeof(path));
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        if (storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_EXISTING))
+        {
+            storage_file_seek(file, static_cast<uint32_t>(size), true);
+            storage_file_truncate(file);
+        }
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+    }
+
+    // The save strategy the app does not use: patch one hole entry of
+    // state.bin in place
+    bool patchState(uint32_t i)
+    {
+        char path[256];
+        GolfScoreHostAccess::statePath(path, sizeof(path));
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        bool patched = false;
+        if (storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING))
+        {
+            uint32_t entries = Players * Holes;
+            uint32_t offset = static_cast<uint32_t>(storage_file_size(file)) - (entries - i % entries) * sizeof(GolfScoreHoleEntry);
+            GolfScoreHoleEntry entry;
+            patched = storage_file_seek(file, offset, true) &&
+                      storage_file_read(file, &entry, sizeof(entry)) == sizeof(entry) &&
+                      storage_file_seek(file, offset, true) &&
+                      storage_file_write(file, &entry, sizeof(entry)) == sizeof(entry);
+        }
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+        return patched;
+    }
+
+    void benchScoring(GolfScoreApp &app)
+    {
+        // Alternating +1/-1 keeps strokes stable; every edit hits the
+        // journal and every JournalCompactEntries-th rewrites state.bin
+        run("adjust_score", 0, 4096, [&](uint32_t i)
+            { app.adjustScore(static_cast<uint8_t>((i / 2) % Players), static_cast<uint8_t>((i / 8) % Holes), (i & 1) ? -1 : 1); });
+
+        run("get_total_score", 0, 1000000, [&](uint32_t i)
+            { sink = sink + app.getTotalScore(static_cast<uint8_t>(i % Players)); });
+        run("get_relative_to_par", 0, 1000000, [&](uint32_t i)
+            { sink = sink + static_cast<uint32_t>(app.getRelativeToPar(static_cast<uint8_t>(i % Players))); });
+        run("is_round_complete", 0, 1000000, [&](uint32_t)
+            { sink = sink + app.isRoundComplete(); });
+
+        run("write_state", 0, 1000, [&](uint32_t)
+            { sink = sink + GolfScoreHostAccess::writeState(app); });
+        run("patch_state", 0, 1000, [&](uint32_t i)
+            { sink = sink + patchState(i); });
+        run("load_state", 0, 1000, [&](uint32_t)
+            { GolfScoreHostAccess::loadState(app); });
+    }
+
+    void benchHistory(GolfScoreApp &app, uint32_t rounds)
+    {
+        // Appends land on a log of the stated size, then are cut off again
+        uint64_t size = historySize();
+        run("export_round_history", rounds, 200, [&](uint32_t)
+            { sink = sink + app.exportRoundHistory(); });
+        truncateHistory(size);
+
+        GolfScoreRoundLog log;
+        uint32_t opens = rounds >= 10000 ? 3 : 200;
+        run("read_history_open", rounds, opens, [&](uint32_t)
+            { sink = sink + log.open(); });
+        if (log.roundCount() != rounds)
+        {
+            fprintf(stderr, "bench: log has %u rounds, expected %u\n", static_cast<unsigned>(log.roundCount()), static_cast<unsigned>(rounds));
+        }
+
+        // Scattered fetches defeat the record cache like fast scrolling does
+        uint32_t seed = 1;
+        GolfScoreHistoryRecord record;
+        run("read_history_fetch", rounds, 2000, [&](uint32_t)
+            {
+                seed = seed * 1664525 + 1013904223;
+                sink = sink + log.fetch((seed >> 8) % rounds, record); });
+
+        // Scrolling down the newest-first list steps to ever older rounds
+        run("read_history_scroll", rounds, 2000, [&](uint32_t i)
+            { sink = sink + log.fetch(rounds - 1 - i % rounds, record); });
+        log.close();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bool quick = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--quick") == 0)
+        {
+            quick = true;
+        }
+        else if (strcmp(argv[i], "--sd") == 0)
+        {
+            host_storage_set_latency(&host_storage_latency_flipper);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--quick] [--sd]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    host_log_set_level(FuriLogLevelError);
+    host_storage_wipe();
+
+    GolfScoreApp app;
+    app.setPlayerCount(Players);
+    app.setHoleCount(Holes);
+    for (uint8_t player = 0; player < Players; ++player)
+    {
+        for (uint8_t hole = 0; hole < Holes; ++hole)
+        {
+            app.adjustScore(player, hole, static_cast<int8_t>(app.getPar(hole) + (player + hole) % 3 - 1));
+        }
+    }
+
+    printf("benchmark,log_rounds,iterations,ns_per_op,sd_us,opens,writes,bytes_written,blocks_written,reads,bytes_read,allocs,alloc_bytes\n");
+    benchScoring(app);
+
+    DateTime now;
+    furi_hal_rtc_get_datetime(&now);
+    uint32_t logged = 0;
+    for (uint32_t rounds : {10u, 1000u, 100000u})
+    {
+        if (quick && rounds > 1000)
+        {
+            break;
+        }
+        for (; logged < rounds; ++logged)
+        {
+            nextMinute(now);
+            furi_hal_rtc_set_datetime(&now);
+            app.exportRoundHistory();
+        }
+        benchHistory(app, rounds);
+    }
+
+    host_storage_wipe();
+    return 0;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+// Host programs reach GolfScoreApp's private save path through this friend
+// (declared in app.hpp when GOLF_SCORE_HOST is defined).
+
+#include "app.hpp"
+
+#include <cstdio>
+
+struct GolfScoreHostAccess
+{
+    static bool writeState(const GolfScoreApp &app)
+    {
+        return app.writeStateToFile(app.state, app.round);
+    }
+
+    static void loadState(GolfScoreApp &app)
+    {
+        app.loadState();
+    }
+
+    static const GolfScorePlayerAggregate &aggregate(const GolfScoreApp &app, uint8_t player)
+    {
+        return app.round.aggregate(player);
+    }
+
+    static uint8_t generation(const GolfScoreApp &app)
+    {
+        return app.journalGeneration;
+    }
+
+    static void statePath(char *path, size_t size)
+    {
+        snprintf(path, size, STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/state.bin", APP_ID);
+    }
+
+    static void journalPath(char *path, size_t size)
+    {
+        snprintf(path, size, STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/state.journal", APP_ID);
+    }
+};
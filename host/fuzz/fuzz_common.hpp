@@ -0,0 +1,87 @@
+#pragma once
+
+// Shared pieces of the fuzz targets: one app instance for the whole run,
+// file plumbing through the Storage API and the invariants every loaded
+// round must meet.
+
+#include "app.hpp"
+#include "common/host_access.hpp"
+#include "host_shim.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Reported as a crash so the fuzzer keeps the input
+#define FUZZ_CHECK(expr)                                                             \
+    do                                                                               \
+    {                                                                                \
+        if (!(expr))                                                                 \
+        {                                                                            \
+            fprintf(stderr, "%s:%d: FUZZ_CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            abort();                                                                 \
+        }                                                                            \
+    } while (0)
+
+inline GolfScoreApp &fuzz_app()
+{
+    static GolfScoreApp *app = []
+    {
+        host_log_set_level(FuriLogLevelNone);
+        host_storage_wipe();
+        return new GolfScoreApp();
+    }();
+    return *app;
+}
+
+inline void fuzz_write_file(const char *path, const uint8_t *data, size_t size)
+{
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    File *file = storage_file_alloc(storage);
+    FUZZ_CHECK(storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    FUZZ_CHECK(size == 0 || storage_file_write(file, data, size) == size);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+inline void fuzz_remove_file(const char *path)
+{
+    Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+    storage_common_remove(storage, path);
+    furi_record_close(RECORD_STORAGE);
+}
+
+// Whatever was on disk, the loaded round is one the app could have built
+inline void fuzz_check_round(const GolfScoreApp &app)
+{
+    uint8_t players = app.getPlayerCount();
+    uint8_t holes = app.getHoleCount();
+    FUZZ_CHECK(players >= 1 && players <= GolfScoreMaxPlayers);
+    FUZZ_CHECK(holes >= 1 && holes <= GolfScoreMaxHoles);
+
+    for (uint8_t hole = 0; hole < holes; ++hole)
+    {
+        FUZZ_CHECK(app.getPar(hole) >= GolfScoreMinPar && app.getPar(hole) <= GolfScoreMaxPar);
+        FUZZ_CHECK(app.getStrokeIndex(hole) >= 1 && app.getStrokeIndex(hole) <= holes);
+    }
+
+    for (uint8_t player = 0; player < players; ++player)
+    {
+        const char *name = app.getPlayerName(player);
+        FUZZ_CHECK(memchr(name, '\0', GolfScoreMaxNameLength) != nullptr);
+        FUZZ_CHECK(app.getHandicap(player) >= GolfScoreMinHandicap && app.getHandicap(player) <= GolfScoreMaxHandicap);
+
+        uint16_t total = 0;
+        for (uint8_t hole = 0; hole < holes; ++hole)
+        {
+            GolfScoreHoleEntry entry = app.getHoleEntry(player, hole);
+            FUZZ_CHECK(entry.strokes <= GolfScoreMaxStrokes);
+            FUZZ_CHECK(entry.fairway <= GolfScoreFairwayMissed);
+            total = static_cast<uint16_t>(total + entry.strokes);
+        }
+        FUZZ_CHECK(app.getTotalScore(player) == total);
+
+        char standing[32];
+        app.getStanding(player, standing, sizeof(standing));
+    }
+}
@@ -0,0 +1,17 @@
+// state.bin of any version and any content, loaded with no journal.
+
+#include "fuzz/fuzz_common.hpp"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    GolfScoreApp &app = fuzz_app();
+    char path[256];
+    GolfScoreHostAccess::journalPath(path, sizeof(path));
+    fuzz_remove_file(path);
+    GolfScoreHostAccess::statePath(path, sizeof(path));
+    fuzz_write_file(path, data, size);
+
+    GolfScoreHostAccess::loadState(app);
+    fuzz_check_round(app);
+    return 0;
+}
@@ -0,0 +1,29 @@
+// The migration from the fixed four-player layouts: the version byte is
+// forced to 1 or 2 so every input takes that path.
+
+#include "fuzz/fuzz_common.hpp"
+
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    GolfScoreApp &app = fuzz_app();
+    std::vector<uint8_t> bytes(data, data + size);
+    bytes[0] = (bytes[0] & 1) ? 2 : 1;
+
+    char path[256];
+    GolfScoreHostAccess::journalPath(path, sizeof(path));
+    fuzz_remove_file(path);
+    GolfScoreHostAccess::statePath(path, sizeof(path));
+    fuzz_write_file(path, bytes.data(), bytes.size());
+
+    GolfScoreHostAccess::loadState(app);
+    fuzz_check_round(app);
+    FUZZ_CHECK(app.getPlayerCount() <= 4);
+    return 0;
+}
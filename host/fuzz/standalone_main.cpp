@@ -0,0 +1,83 @@
+// Replays files or directories of inputs through LLVMFuzzerTestOneInput for
+// compilers without libFuzzer. Flags (-runs=0 and the like) are ignored.
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+namespace
+{
+    bool run_file(const std::string &path)
+    {
+        FILE *file = fopen(path.c_str(), "rb");
+        if (!file)
+        {
+            fprintf(stderr, "cannot open %s\n", path.c_str());
+            return false;
+        }
+        std::vector<uint8_t> data;
+        uint8_t chunk[4096];
+        size_t read;
+        while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        {
+            data.insert(data.end(), chunk, chunk + read);
+        }
+        fclose(file);
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t inputs = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string path = argv[i];
+        if (path[0] == '-')
+        {
+            continue;
+        }
+
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0)
+        {
+            fprintf(stderr, "cannot open %s\n", path.c_str());
+            return 1;
+        }
+        if (!S_ISDIR(info.st_mode))
+        {
+            inputs += run_file(path) ? 1 : 0;
+            continue;
+        }
+
+        // Sorted so runs repeat
+        std::vector<std::string> names;
+        if (DIR *dir = opendir(path.c_str()))
+        {
+            while (struct dirent *entry = readdir(dir))
+            {
+                if (entry->d_name[0] != '.')
+                {
+                    names.push_back(entry->d_name);
+                }
+            }
+            closedir(dir);
+        }
+        std::sort(names.begin(), names.end());
+        for (const std::string &name : names)
+        {
+            inputs += run_file(path + "/" + name) ? 1 : 0;
+        }
+    }
+    printf("%zu inputs replayed\n", inputs);
+    return inputs > 0 ? 0 : 1;
+}
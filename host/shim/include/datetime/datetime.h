@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct
+    {
+        uint8_t hour;
+        uint8_t minute;
+        uint8_t second;
+        uint8_t day;
+        uint8_t month;
+        uint16_t year;
+        uint8_t weekday;
+    } DateTime;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,99 @@
+#pragma once
+
+// Host stand-in for the Furi core API: logging, records, ticks and timers.
+// Time only advances when the host harness calls host_advance_ms().
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <furi/core/string.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define UNUSED(x) (void)(x)
+#define COUNT_OF(x) (sizeof(x) / sizeof(x[0]))
+
+#define furi_assert(expr) \
+    do                    \
+    {                     \
+        if (!(expr))      \
+        {                 \
+            abort();      \
+        }                 \
+    } while (0)
+#define furi_check(expr) furi_assert(expr)
+
+// The host runs everything on one thread, so there is nothing to exclude
+#define FURI_CRITICAL_ENTER() ((void)0)
+#define FURI_CRITICAL_EXIT() ((void)0)
+
+    typedef enum
+    {
+        FuriLogLevelDefault = 0,
+        FuriLogLevelNone = 1,
+        FuriLogLevelError = 2,
+        FuriLogLevelWarn = 3,
+        FuriLogLevelInfo = 4,
+        FuriLogLevelDebug = 5,
+        FuriLogLevelTrace = 6,
+    } FuriLogLevel;
+
+    void furi_log_print_format(FuriLogLevel level, const char *tag, const char *format, ...)
+        __attribute__((format(printf, 3, 4)));
+
+#define FURI_LOG_E(tag, format, ...) furi_log_print_format(FuriLogLevelError, tag, format, ##__VA_ARGS__)
+#define FURI_LOG_W(tag, format, ...) furi_log_print_format(FuriLogLevelWarn, tag, format, ##__VA_ARGS__)
+#define FURI_LOG_I(tag, format, ...) furi_log_print_format(FuriLogLevelInfo, tag, format, ##__VA_ARGS__)
+#define FURI_LOG_D(tag, format, ...) furi_log_print_format(FuriLogLevelDebug, tag, format, ##__VA_ARGS__)
+#define FURI_LOG_T(tag, format, ...) furi_log_print_format(FuriLogLevelTrace, tag, format, ##__VA_ARGS__)
+
+    typedef enum
+    {
+        FuriStatusOk = 0,
+        FuriStatusError = -1,
+        FuriStatusErrorTimeout = -2,
+        FuriStatusErrorResource = -3,
+        FuriStatusErrorParameter = -4,
+    } FuriStatus;
+
+    void *furi_record_open(const char *name);
+    void furi_record_close(const char *name);
+
+    uint32_t furi_get_tick(void);
+    uint32_t furi_kernel_get_tick_frequency(void);
+    uint32_t furi_ms_to_ticks(uint32_t milliseconds);
+    void furi_delay_ms(uint32_t milliseconds);
+    void furi_delay_tick(uint32_t ticks);
+
+    typedef struct FuriTimer FuriTimer;
+    typedef void (*FuriTimerCallback)(void *context);
+    typedef enum
+    {
+        FuriTimerTypeOnce = 0,
+        FuriTimerTypePeriodic = 1,
+    } FuriTimerType;
+
+    FuriTimer *furi_timer_alloc(FuriTimerCallback func, FuriTimerType type, void *context);
+    void furi_timer_free(FuriTimer *instance);
+    FuriStatus furi_timer_start(FuriTimer *instance, uint32_t ticks);
+    FuriStatus furi_timer_restart(FuriTimer *instance, uint32_t ticks);
+    FuriStatus furi_timer_stop(FuriTimer *instance);
+    uint32_t furi_timer_is_running(FuriTimer *instance);
+
+    typedef void *FuriThreadId;
+    FuriThreadId furi_thread_get_current_id(void);
+    uint32_t furi_thread_get_stack_space(FuriThreadId thread_id);
+
+    size_t memmgr_get_free_heap(void);
+    size_t memmgr_get_minimum_free_heap(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct FuriString FuriString;
+
+#define FURI_STRING_FAILURE ((size_t) - 1)
+
+    FuriString *furi_string_alloc(void);
+    FuriString *furi_string_alloc_set_str(const char cstr_source[]);
+    FuriString *furi_string_alloc_copy(const FuriString *source);
+    FuriString *furi_string_alloc_printf(const char format[], ...) __attribute__((format(printf, 1, 2)));
+    void furi_string_free(FuriString *string);
+    void furi_string_reset(FuriString *string);
+    void furi_string_reserve(FuriString *string, size_t size);
+    size_t furi_string_size(const FuriString *string);
+    bool furi_string_empty(const FuriString *string);
+    const char *furi_string_get_cstr(const FuriString *string);
+    char furi_string_get_char(const FuriString *string, size_t index);
+    void furi_string_set_char(FuriString *string, size_t index, const char c);
+    void furi_string_set_str(FuriString *string, const char cstr[]);
+    void furi_string_set_strn(FuriString *string, const char cstr[], size_t n);
+    void furi_string_set_copy(FuriString *string, const FuriString *source);
+    void furi_string_push_back(FuriString *string, char c);
+    void furi_string_cat_str(FuriString *string, const char cstr[]);
+    void furi_string_cat_copy(FuriString *string, const FuriString *other);
+    int furi_string_printf(FuriString *string, const char format[], ...) __attribute__((format(printf, 2, 3)));
+    int furi_string_vprintf(FuriString *string, const char format[], va_list args);
+    int furi_string_cat_printf(FuriString *string, const char format[], ...) __attribute__((format(printf, 2, 3)));
+    int furi_string_cat_vprintf(FuriString *string, const char format[], va_list args);
+    int furi_string_cmp_str(const FuriString *string, const char cstring[]);
+    int furi_string_cmp_copy(const FuriString *string, const FuriString *other);
+    void furi_string_mid(FuriString *string, size_t start, size_t length);
+    void furi_string_left(FuriString *string, size_t index);
+    void furi_string_right(FuriString *string, size_t index);
+    size_t furi_string_search_char(const FuriString *string, char c, size_t start);
+    size_t furi_string_search_str(const FuriString *string, const char search[], size_t start);
+
+#ifdef __cplusplus
+}
+
+inline FuriString *furi_string_alloc_set(const char *cstr) { return furi_string_alloc_set_str(cstr); }
+inline FuriString *furi_string_alloc_set(const FuriString *source) { return furi_string_alloc_copy(source); }
+inline void furi_string_set(FuriString *string, const char *cstr) { furi_string_set_str(string, cstr); }
+inline void furi_string_set(FuriString *string, const FuriString *source) { furi_string_set_copy(string, source); }
+inline void furi_string_cat(FuriString *string, const char *cstr) { furi_string_cat_str(string, cstr); }
+inline void furi_string_cat(FuriString *string, const FuriString *other) { furi_string_cat_copy(string, other); }
+inline int furi_string_cmp(const FuriString *string, const char *cstr) { return furi_string_cmp_str(string, cstr); }
+inline int furi_string_cmp(const FuriString *string, const FuriString *other) { return furi_string_cmp_copy(string, other); }
+#else
+#define furi_string_alloc_set(source) \
+    _Generic((source), char *: furi_string_alloc_set_str, const char *: furi_string_alloc_set_str, default: furi_string_alloc_copy)(source)
+#define furi_string_set(string, source) \
+    _Generic((source), char *: furi_string_set_str, const char *: furi_string_set_str, default: furi_string_set_copy)(string, source)
+#define furi_string_cat(string, source) \
+    _Generic((source), char *: furi_string_cat_str, const char *: furi_string_cat_str, default: furi_string_cat_copy)(string, source)
+#define furi_string_cmp(string, other) \
+    _Generic((other), char *: furi_string_cmp_str, const char *: furi_string_cmp_str, default: furi_string_cmp_copy)(string, other)
+#endif
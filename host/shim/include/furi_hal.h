@@ -0,0 +1,4 @@
+#pragma once
+
+#include <furi.h>
+#include <furi_hal_rtc.h>
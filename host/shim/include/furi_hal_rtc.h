@@ -0,0 +1,15 @@
+#pragma once
+
+#include <datetime/datetime.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    void furi_hal_rtc_get_datetime(DateTime *datetime);
+    void furi_hal_rtc_set_datetime(DateTime *datetime);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gui/canvas.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    void elements_multiline_text(Canvas *canvas, int32_t x, int32_t y, const char *text);
+    void elements_multiline_text_aligned(Canvas *canvas, int32_t x, int32_t y, Align horizontal, Align vertical, const char *text);
+    void elements_slightly_rounded_frame(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height);
+    void elements_slightly_rounded_box(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height);
+    void elements_scrollbar(Canvas *canvas, size_t pos, size_t total);
+    void elements_button_left(Canvas *canvas, const char *str);
+    void elements_button_right(Canvas *canvas, const char *str);
+    void elements_button_center(Canvas *canvas, const char *str);
+
+#ifdef __cplusplus
+}
+#endif
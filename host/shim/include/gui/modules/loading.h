@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gui/view.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct Loading Loading;
+
+    Loading *loading_alloc(void);
+    void loading_free(Loading *loading);
+    View *loading_get_view(Loading *loading);
+
+#ifdef __cplusplus
+}
+#endif
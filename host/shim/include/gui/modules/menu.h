@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gui/view.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct Menu Menu;
+
+    Menu *menu_alloc(void);
+    void menu_free(Menu *menu);
+    View *menu_get_view(Menu *menu);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <gui/view.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct Popup Popup;
+    typedef void (*PopupCallback)(void *context);
+
+    Popup *popup_alloc(void);
+    void popup_free(Popup *popup);
+    View *popup_get_view(Popup *popup);
+    void popup_set_callback(Popup *popup, PopupCallback callback);
+    void popup_set_context(Popup *popup, void *context);
+    void popup_set_header(Popup *popup, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical);
+    void popup_set_text(Popup *popup, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <gui/view.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct Submenu Submenu;
+    typedef void (*SubmenuItemCallback)(void *context, uint32_t index);
+
+    Submenu *submenu_alloc(void);
+    void submenu_free(Submenu *submenu);
+    View *submenu_get_view(Submenu *submenu);
+    void submenu_add_item(Submenu *submenu, const char *label, uint32_t index, SubmenuItemCallback callback, void *callback_context);
+    void submenu_reset(Submenu *submenu);
+    void submenu_set_selected_item(Submenu *submenu, uint32_t index);
+    void submenu_set_header(Submenu *submenu, const char *header);
+
+#ifdef __cplusplus
+}
+#endif
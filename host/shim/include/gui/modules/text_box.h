@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gui/view.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct TextBox TextBox;
+
+    TextBox *text_box_alloc(void);
+    void text_box_free(TextBox *text_box);
+    View *text_box_get_view(TextBox *text_box);
+    void text_box_set_text(TextBox *text_box, const char *text);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <gui/view.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct Widget Widget;
+
+    Widget *widget_alloc(void);
+    void widget_free(Widget *widget);
+    void widget_reset(Widget *widget);
+    View *widget_get_view(Widget *widget);
+    void widget_add_text_scroll_element(Widget *widget, uint8_t x, uint8_t y, uint8_t width, uint8_t height, const char *text);
+
+    // Host-only: text of the most recent scroll element, for assertions.
+    const char *widget_host_text(Widget *widget);
+
+#ifdef __cplusplus
+}
+#endif
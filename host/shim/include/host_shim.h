@@ -0,0 +1,174 @@
+#pragma once
+
+// Controls for driving the app on a Linux host: only tests, benchmarks and
+// tools include this, never the app itself.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <furi.h>
+#include <gui/canvas.h>
+#include <gui/view_dispatcher.h>
+#include <input/input.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Logging: messages above the level are dropped (default: warnings)
+    void host_log_set_level(FuriLogLevel level);
+
+    // Time: the tick (1 kHz) only moves here, firing due timers in order
+    void host_advance_ms(uint32_t milliseconds);
+
+    // Storage: "/ext" maps to this directory, a fresh mkdtemp() one unless
+    // set before first use
+    const char *host_storage_root(void);
+    void host_storage_set_root(const char *path);
+    // Deletes everything under the root, keeping the root itself
+    void host_storage_wipe(void);
+
+    // Storage calls since the last reset; writes and reads count calls that
+    // reached an open file
+    typedef struct
+    {
+        uint32_t opens;
+        uint32_t writes;
+        uint32_t reads;
+        uint32_t seeks;
+        uint64_t bytesWritten;
+        uint64_t bytesRead;
+        uint32_t blocksWritten; // Card blocks programmed (see HostStorageLatency)
+        uint32_t blocksRead;
+        uint64_t busyUs; // Simulated card time, 0 without a latency model
+    } HostStorageStats;
+
+    const HostStorageStats *host_storage_stats(void);
+    void host_storage_reset_stats(void);
+
+    // Faults: the next `count` storage_file_open() calls on exactly `path`
+    // (an app path such as "/ext/...") fail, as on a card that went away
+    void host_storage_fail_opens(const char *path, uint32_t count);
+
+    // SD card latency model. Files are accessed in blocks of blockSize bytes
+    // through a one-block buffer per open file, as FatFs does: reading a block
+    // or writing part of one loads it, and a written block is programmed when
+    // the file moves to another block, syncs or closes. Every cost advances
+    // the tick without running timers. Costs vary by up to jitterPercent
+    // either way (seeded, so runs repeat), and every stallEvery-th programmed
+    // block adds stallUs for the card's own housekeeping.
+    typedef struct
+    {
+        uint32_t openUs;  // Each open, mkdir, remove or rename
+        uint32_t closeUs; // Directory entry update when a written file closes
+        uint32_t seekUs;
+        uint32_t readUs;  // Per read call, on top of block loads
+        uint32_t writeUs; // Per write call, on top of block programming
+        uint32_t blockSize;
+        uint32_t blockReadUs;
+        uint32_t blockWriteUs;
+        uint32_t stallEvery;
+        uint32_t stallUs;
+        uint32_t jitterPercent;
+        uint32_t seed;
+    } HostStorageLatency;
+
+    // Costs in the range measured on Flipper Zero SD cards
+    extern const HostStorageLatency host_storage_latency_flipper;
+
+    // NULL turns the model off (the default); the model is copied
+    void host_storage_set_latency(const HostStorageLatency *latency);
+
+    // Heap: operator new calls since the last reset. Using these links in
+    // counting replacements of the global operator new and delete.
+    typedef struct
+    {
+        uint64_t allocations;
+        uint64_t bytes;
+    } HostAllocStats;
+
+    const HostAllocStats *host_alloc_stats(void);
+    void host_alloc_reset_stats(void);
+
+    // Screen: input goes to the topmost view port with an input callback,
+    // else to the dispatcher's current view (Back falls through to its
+    // previous callback). Queued custom events are handled after each call.
+    void host_send_input(InputKey key, InputType type);
+    void host_press(InputKey key);      // Press, Short, Release
+    void host_long_press(InputKey key); // Press, Long, Release
+    void host_pump(void);
+    // Redraws what the device would show into the shared recording canvas
+    Canvas *host_render(void);
+    ViewDispatcher *host_view_dispatcher(void); // Most recently allocated
+    uint32_t host_current_view(void);           // VIEW_NONE if nothing is shown
+    bool host_dispatcher_stopped(void);
+
+    // Dialogs: dialog_message_show() returns at once; these report the last one
+    const char *host_last_dialog_header(void);
+    const char *host_last_dialog_text(void);
+
+    // Recording canvas, rasterized like u8g2 into a 128x64 frame
+    typedef enum
+    {
+        HostCanvasOpClear,
+        HostCanvasOpStr,
+        HostCanvasOpGlyph,
+        HostCanvasOpDot,
+        HostCanvasOpLine,
+        HostCanvasOpBox,
+        HostCanvasOpFrame,
+        HostCanvasOpXbm,
+        HostCanvasOpCount,
+    } HostCanvasOpType;
+
+    typedef struct
+    {
+        HostCanvasOpType type;
+        Color color;
+        int32_t x;
+        int32_t y;
+        int32_t width; // Box, frame and bitmap size; line end point
+        int32_t height;
+        char text[64]; // Str only, truncated
+    } HostCanvasOp;
+
+    // Draw calls since the last canvas_reset(), i.e. for one frame
+    typedef struct
+    {
+        uint32_t ops; // Every op recorded, clears included
+        uint32_t strings;
+        uint32_t glyphs; // Glyphs rasterized by strings and draw_glyph
+        uint32_t textBytes;
+        uint32_t boxes; // Boxes, rounded ones included
+        uint32_t frames;
+        uint32_t lines;
+        uint32_t dots;
+        uint32_t bitmaps;
+        uint32_t fontSets;     // Font set calls
+        uint32_t fontSwitches; // Font set calls that changed the font
+        uint32_t widthQueries; // String and glyph width calls by the caller
+        uint32_t pixels;       // Pixel writes, overdraw included
+    } HostCanvasStats;
+
+#define HOST_CANVAS_WIDTH 128
+#define HOST_CANVAS_HEIGHT 64
+// Plain PBM ("P1") of a frame: header plus one text line per pixel row
+#define HOST_CANVAS_PBM_SIZE (16 + (HOST_CANVAS_WIDTH + 1) * HOST_CANVAS_HEIGHT)
+
+    Canvas *host_canvas_alloc(void);
+    void host_canvas_free(Canvas *canvas);
+    size_t host_canvas_op_count(const Canvas *canvas);
+    const HostCanvasOp *host_canvas_op(const Canvas *canvas, size_t index);
+    // True if any string drawn since the last clear contains needle
+    bool host_canvas_has_text(const Canvas *canvas, const char *needle);
+    const HostCanvasStats *host_canvas_stats(const Canvas *canvas);
+    bool host_canvas_pixel(const Canvas *canvas, int32_t x, int32_t y);
+    // Writes the frame as plain PBM; returns the full length like snprintf
+    size_t host_canvas_pbm(const Canvas *canvas, char *out, size_t size);
+    bool host_canvas_write_pbm(const Canvas *canvas, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define RECORD_INPUT_EVENTS "input_events"
+
+    typedef enum
+    {
+        InputKeyUp,
+        InputKeyDown,
+        InputKeyRight,
+        InputKeyLeft,
+        InputKeyOk,
+        InputKeyBack,
+        InputKeyMAX,
+    } InputKey;
+
+    typedef enum
+    {
+        InputTypePress,
+        InputTypeRelease,
+        InputTypeShort,
+        InputTypeLong,
+        InputTypeRepeat,
+        InputTypeMAX,
+    } InputType;
+
+    typedef struct
+    {
+        uint32_t sequence;
+        InputKey key;
+        InputType type;
+    } InputEvent;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define RECORD_NOTIFICATION "notification"
+
+    typedef struct NotificationApp NotificationApp;
+
+#ifdef __cplusplus
+}
+#endif
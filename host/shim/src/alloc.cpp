@@ -0,0 +1,77 @@
+// Counting replacements of the global operator new and delete. They are only
+// linked into programs that read the counters.
+
+#include "host_shim.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    HostAllocStats stats{};
+
+    void *allocate(size_t size)
+    {
+        ++stats.allocations;
+        stats.bytes += size;
+        void *pointer = malloc(size ? size : 1);
+        if (!pointer)
+        {
+            abort();
+        }
+        return pointer;
+    }
+}
+
+extern "C"
+{
+    const HostAllocStats *host_alloc_stats(void)
+    {
+        return &stats;
+    }
+
+    void host_alloc_reset_stats(void)
+    {
+        stats = HostAllocStats{};
+    }
+}
+
+void *operator new(size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new[](size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept
+{
+    free(pointer);
+}
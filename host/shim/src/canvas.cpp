@@ -0,0 +1,759 @@
+// Recording canvas: every draw call is kept as an op for tests to inspect,
+// counted for per-frame cost reports and rasterized into a 128x64 buffer
+// the way u8g2 does it on the device. u8g2 fonts are decoded glyph by glyph;
+// the firmware's built-in fonts are not available here, so they are drawn
+// with the closest font the app embeds.
+
+#include <gui/canvas.h>
+#include <gui/elements.h>
+
+#include "host_shim.h"
+
+#include "font/font_source.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+struct Canvas
+{
+    std::vector<HostCanvasOp> ops;
+    std::array<uint8_t, HOST_CANVAS_WIDTH * HOST_CANVAS_HEIGHT> pixels{};
+    HostCanvasStats stats{};
+    Color color = ColorBlack;
+    const uint8_t *font = nullptr;
+};
+
+namespace
+{
+    constexpr int32_t Width = HOST_CANVAS_WIDTH;
+    constexpr int32_t Height = HOST_CANVAS_HEIGHT;
+
+    // u8g2 font header fields
+    constexpr size_t FontHeaderSize = 23;
+    constexpr size_t FontBitsPer0 = 2;
+    constexpr size_t FontBitsPer1 = 3;
+    constexpr size_t FontBitsPerWidth = 4;
+    constexpr size_t FontBitsPerHeight = 5;
+    constexpr size_t FontBitsPerX = 6;
+    constexpr size_t FontBitsPerY = 7;
+    constexpr size_t FontBitsPerDelta = 8;
+    constexpr size_t FontMaxHeight = 10;
+    constexpr size_t FontAscentA = 13;
+    constexpr size_t FontStartUpperA = 17;
+    constexpr size_t FontStartLowerA = 19;
+
+    const uint8_t *builtin_font(Font font)
+    {
+        switch (font)
+        {
+        case FontPrimary:
+            return u8g2_font_6x10_tf;
+        case FontBigNumbers:
+            return u8g2_font_9x15_tf;
+        default:
+            return u8g2_font_5x8_tf;
+        }
+    }
+
+    void record(Canvas *canvas, HostCanvasOpType type, int32_t x, int32_t y, int32_t width, int32_t height, const char *text = nullptr)
+    {
+        HostCanvasOp op{};
+        op.type = type;
+        op.color = canvas->color;
+        op.x = x;
+        op.y = y;
+        op.width = width;
+        op.height = height;
+        if (text)
+        {
+            snprintf(op.text, sizeof(op.text), "%s", text);
+        }
+        canvas->ops.push_back(op);
+        ++canvas->stats.ops;
+    }
+
+    void pixel(Canvas *canvas, int32_t x, int32_t y)
+    {
+        if (x < 0 || y < 0 || x >= Width || y >= Height)
+        {
+            return;
+        }
+        uint8_t &value = canvas->pixels[static_cast<size_t>(y) * Width + x];
+        value = canvas->color == ColorXOR ? !value : canvas->color == ColorBlack;
+        ++canvas->stats.pixels;
+    }
+
+    void hline(Canvas *canvas, int32_t x, int32_t y, int32_t length)
+    {
+        for (int32_t i = 0; i < length; ++i)
+        {
+            pixel(canvas, x + i, y);
+        }
+    }
+
+    void vline(Canvas *canvas, int32_t x, int32_t y, int32_t length)
+    {
+        for (int32_t i = 0; i < length; ++i)
+        {
+            pixel(canvas, x, y + i);
+        }
+    }
+
+    void fill(Canvas *canvas, int32_t x, int32_t y, int32_t width, int32_t height)
+    {
+        for (int32_t row = 0; row < height; ++row)
+        {
+            hline(canvas, x, y + row, width);
+        }
+    }
+
+    // Quadrants as u8g2 names them
+    enum Quadrant : uint8_t
+    {
+        UpperRight = 1,
+        UpperLeft = 2,
+        LowerLeft = 4,
+        LowerRight = 8,
+    };
+
+    // u8g2's midpoint circle, either as an outline or as a filled disc
+    void arc(Canvas *canvas, int32_t x0, int32_t y0, int32_t radius, uint8_t quadrants, bool disc)
+    {
+        auto section = [&](int32_t x, int32_t y)
+        {
+            if (disc)
+            {
+                if (quadrants & UpperRight)
+                {
+                    vline(canvas, x0 + x, y0 - y, y + 1);
+                    vline(canvas, x0 + y, y0 - x, x + 1);
+                }
+                if (quadrants & UpperLeft)
+                {
+                    vline(canvas, x0 - x, y0 - y, y + 1);
+                    vline(canvas, x0 - y, y0 - x, x + 1);
+                }
+                if (quadrants & LowerRight)
+                {
+                    vline(canvas, x0 + x, y0, y + 1);
+                    vline(canvas, x0 + y, y0, x + 1);
+                }
+                if (quadrants & LowerLeft)
+                {
+                    vline(canvas, x0 - x, y0, y + 1);
+                    vline(canvas, x0 - y, y0, x + 1);
+                }
+                return;
+            }
+            if (quadrants & UpperRight)
+            {
+                pixel(canvas, x0 + x, y0 - y);
+                pixel(canvas, x0 + y, y0 - x);
+            }
+            if (quadrants & UpperLeft)
+            {
+                pixel(canvas, x0 - x, y0 - y);
+                pixel(canvas, x0 - y, y0 - x);
+            }
+            if (quadrants & LowerRight)
+            {
+                pixel(canvas, x0 + x, y0 + y);
+                pixel(canvas, x0 + y, y0 + x);
+            }
+            if (quadrants & LowerLeft)
+            {
+                pixel(canvas, x0 - x, y0 + y);
+                pixel(canvas, x0 - y, y0 + x);
+            }
+        };
+
+        int32_t f = 1 - radius;
+        int32_t ddx = 1;
+        int32_t ddy = -2 * radius;
+        int32_t x = 0;
+        int32_t y = radius;
+        section(x, y);
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                --y;
+                ddy += 2;
+                f += ddy;
+            }
+            ++x;
+            ddx += 2;
+            f += ddx;
+            section(x, y);
+        }
+    }
+
+    // Bit reader over a glyph's packed header and run-length bitmap
+    struct GlyphReader
+    {
+        const uint8_t *data;
+        uint8_t bit = 0;
+
+        uint32_t bits(uint8_t count)
+        {
+            uint32_t value = data[0] >> bit;
+            uint8_t end = static_cast<uint8_t>(bit + count);
+            if (end >= 8)
+            {
+                ++data;
+                value |= static_cast<uint32_t>(data[0]) << (8 - bit);
+                end = static_cast<uint8_t>(end - 8);
+            }
+            bit = end;
+            return value & ((1u << count) - 1);
+        }
+
+        int32_t signedBits(uint8_t count)
+        {
+            return static_cast<int32_t>(bits(count)) - (1 << (count - 1));
+        }
+    };
+
+    struct Glyph
+    {
+        const uint8_t *font = nullptr;
+        GlyphReader reader{nullptr};
+        uint32_t width = 0;
+        uint32_t height = 0;
+        int32_t x = 0;
+        int32_t y = 0;
+        int32_t advance = 0;
+    };
+
+    bool find_glyph(const uint8_t *font, uint16_t encoding, Glyph &glyph)
+    {
+        if (!font || encoding > 0xFF)
+        {
+            return false;
+        }
+
+        const uint8_t *cursor = font + FontHeaderSize;
+        if (encoding >= 'a')
+        {
+            cursor += (font[FontStartLowerA] << 8) | font[FontStartLowerA + 1];
+        }
+        else if (encoding >= 'A')
+        {
+            cursor += (font[FontStartUpperA] << 8) | font[FontStartUpperA + 1];
+        }
+
+        for (; cursor[1] != 0; cursor += cursor[1])
+        {
+            if (cursor[0] == encoding)
+            {
+                glyph.font = font;
+                glyph.reader = GlyphReader{cursor + 2};
+                glyph.width = glyph.reader.bits(font[FontBitsPerWidth]);
+                glyph.height = glyph.reader.bits(font[FontBitsPerHeight]);
+                glyph.x = glyph.reader.signedBits(font[FontBitsPerX]);
+                glyph.y = glyph.reader.signedBits(font[FontBitsPerY]);
+                glyph.advance = glyph.reader.signedBits(font[FontBitsPerDelta]);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Draws one glyph with its baseline at y; background runs are skipped
+    // (transparent font mode, as the firmware sets it). Returns the advance.
+    int32_t draw_glyph(Canvas *canvas, int32_t x, int32_t y, uint16_t encoding)
+    {
+        Glyph glyph;
+        if (!find_glyph(canvas->font, encoding, glyph))
+        {
+            return 0;
+        }
+        ++canvas->stats.glyphs;
+        if (glyph.width == 0)
+        {
+            return glyph.advance;
+        }
+
+        int32_t left = x + glyph.x;
+        int32_t top = y - static_cast<int32_t>(glyph.height) - glyph.y;
+        uint32_t column = 0;
+        uint32_t row = 0;
+        auto run = [&](uint32_t length, bool foreground)
+        {
+            while (true)
+            {
+                uint32_t remaining = glyph.width - column;
+                uint32_t current = std::min(remaining, length);
+                if (foreground)
+                {
+                    hline(canvas, left + static_cast<int32_t>(column), top + static_cast<int32_t>(row), static_cast<int32_t>(current));
+                }
+                if (length < remaining)
+                {
+                    break;
+                }
+                length -= remaining;
+                column = 0;
+                ++row;
+            }
+            column += length;
+        };
+
+        const uint8_t *font = glyph.font;
+        while (row < glyph.height)
+        {
+            uint32_t zeros = glyph.reader.bits(font[FontBitsPer0]);
+            uint32_t ones = glyph.reader.bits(font[FontBitsPer1]);
+            do
+            {
+                run(zeros, false);
+                run(ones, true);
+            } while (glyph.reader.bits(1) != 0 && row < glyph.height);
+        }
+        return glyph.advance;
+    }
+
+    void set_font(Canvas *canvas, const uint8_t *font)
+    {
+        ++canvas->stats.fontSets;
+        if (font != canvas->font)
+        {
+            ++canvas->stats.fontSwitches;
+            canvas->font = font;
+        }
+    }
+
+    void reset_state(Canvas *canvas)
+    {
+        canvas->color = ColorBlack;
+        canvas->font = builtin_font(FontSecondary);
+    }
+}
+
+extern "C"
+{
+    Canvas *host_canvas_alloc(void)
+    {
+        Canvas *canvas = new Canvas();
+        reset_state(canvas);
+        return canvas;
+    }
+
+    void host_canvas_free(Canvas *canvas)
+    {
+        delete canvas;
+    }
+
+    size_t host_canvas_op_count(const Canvas *canvas)
+    {
+        return canvas->ops.size();
+    }
+
+    const HostCanvasOp *host_canvas_op(const Canvas *canvas, size_t index)
+    {
+        return index < canvas->ops.size() ? &canvas->ops[index] : nullptr;
+    }
+
+    bool host_canvas_has_text(const Canvas *canvas, const char *needle)
+    {
+        for (auto op = canvas->ops.rbegin(); op != canvas->ops.rend() && op->type != HostCanvasOpClear; ++op)
+        {
+            if (op->type == HostCanvasOpStr && strstr(op->text, needle))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const HostCanvasStats *host_canvas_stats(const Canvas *canvas)
+    {
+        return &canvas->stats;
+    }
+
+    bool host_canvas_pixel(const Canvas *canvas, int32_t x, int32_t y)
+    {
+        return x >= 0 && y >= 0 && x < Width && y < Height && canvas->pixels[static_cast<size_t>(y) * Width + x];
+    }
+
+    size_t host_canvas_pbm(const Canvas *canvas, char *out, size_t size)
+    {
+        // Plain PBM, one text row per pixel row, so golden diffs stay readable
+        size_t length = static_cast<size_t>(snprintf(out, size, "P1\n%d %d\n", static_cast<int>(Width), static_cast<int>(Height)));
+        for (int32_t y = 0; y < Height; ++y)
+        {
+            for (int32_t x = 0; x <= Width; ++x)
+            {
+                if (length + 1 < size)
+                {
+                    out[length] = x == Width ? '\n' : host_canvas_pixel(canvas, x, y) ? '1' : '0';
+                }
+                ++length;
+            }
+        }
+        if (size > 0)
+        {
+            out[std::min(length, size - 1)] = '\0';
+        }
+        return length;
+    }
+
+    bool host_canvas_write_pbm(const Canvas *canvas, const char *path)
+    {
+        std::vector<char> text(HOST_CANVAS_PBM_SIZE);
+        size_t length = host_canvas_pbm(canvas, text.data(), text.size());
+        FILE *file = fopen(path, "wb");
+        if (!file)
+        {
+            return false;
+        }
+        bool written = fwrite(text.data(), 1, length, file) == length;
+        return fclose(file) == 0 && written;
+    }
+
+    size_t canvas_width(const Canvas *)
+    {
+        return Width;
+    }
+
+    size_t canvas_height(const Canvas *)
+    {
+        return Height;
+    }
+
+    size_t canvas_current_font_height(const Canvas *canvas)
+    {
+        return canvas->font[FontMaxHeight];
+    }
+
+    void canvas_reset(Canvas *canvas)
+    {
+        // As on the device: each frame starts blank, black, in FontSecondary
+        canvas->ops.clear();
+        canvas->pixels.fill(0);
+        canvas->stats = HostCanvasStats{};
+        reset_state(canvas);
+    }
+
+    void canvas_clear(Canvas *canvas)
+    {
+        record(canvas, HostCanvasOpClear, 0, 0, Width, Height);
+        canvas->pixels.fill(0);
+    }
+
+    void canvas_set_color(Canvas *canvas, Color color)
+    {
+        canvas->color = color;
+    }
+
+    void canvas_invert_color(Canvas *canvas)
+    {
+        canvas->color = canvas->color == ColorBlack ? ColorWhite : canvas->color == ColorWhite ? ColorBlack : ColorXOR;
+    }
+
+    void canvas_set_font(Canvas *canvas, Font font)
+    {
+        set_font(canvas, builtin_font(font));
+    }
+
+    void canvas_set_custom_u8g2_font(Canvas *canvas, const uint8_t *font)
+    {
+        set_font(canvas, font);
+    }
+
+    void canvas_draw_str(Canvas *canvas, int32_t x, int32_t y, const char *str)
+    {
+        if (!str)
+        {
+            return;
+        }
+        ++canvas->stats.strings;
+        canvas->stats.textBytes += static_cast<uint32_t>(strlen(str));
+        record(canvas, HostCanvasOpStr, x, y, canvas_string_width(canvas, str), static_cast<int32_t>(canvas_current_font_height(canvas)), str);
+        --canvas->stats.widthQueries; // The op's width is bookkeeping, not a call the app made
+        for (const char *ch = str; *ch; ++ch)
+        {
+            x += draw_glyph(canvas, x, y, static_cast<uint8_t>(*ch));
+        }
+    }
+
+    void canvas_draw_str_aligned(Canvas *canvas, int32_t x, int32_t y, Align horizontal, Align vertical, const char *str)
+    {
+        if (!str)
+        {
+            return;
+        }
+        int32_t width = canvas_string_width(canvas, str);
+        --canvas->stats.widthQueries;
+        int32_t ascent = canvas->font[FontAscentA];
+        if (horizontal == AlignRight)
+        {
+            x -= width;
+        }
+        else if (horizontal == AlignCenter)
+        {
+            x -= width / 2;
+        }
+        if (vertical == AlignTop)
+        {
+            y += ascent;
+        }
+        else if (vertical == AlignCenter)
+        {
+            y += ascent / 2;
+        }
+        canvas_draw_str(canvas, x, y, str);
+    }
+
+    uint16_t canvas_string_width(Canvas *canvas, const char *str)
+    {
+        // u8g2: the advances, except that the last glyph counts its drawn width
+        ++canvas->stats.widthQueries;
+        int32_t width = 0;
+        Glyph last;
+        bool any = false;
+        for (const char *ch = str; ch && *ch; ++ch)
+        {
+            Glyph glyph;
+            if (find_glyph(canvas->font, static_cast<uint8_t>(*ch), glyph))
+            {
+                width += glyph.advance;
+                last = glyph;
+                any = true;
+            }
+        }
+        if (any && last.width != 0)
+        {
+            width += static_cast<int32_t>(last.width) + last.x - last.advance;
+        }
+        return static_cast<uint16_t>(std::max(width, 0));
+    }
+
+    uint16_t canvas_glyph_width(Canvas *canvas, uint16_t symbol)
+    {
+        ++canvas->stats.widthQueries;
+        Glyph glyph;
+        return find_glyph(canvas->font, symbol, glyph) ? static_cast<uint16_t>(std::max(glyph.advance, 0)) : 0;
+    }
+
+    void canvas_draw_glyph(Canvas *canvas, int32_t x, int32_t y, uint16_t ch)
+    {
+        char text[2] = {static_cast<char>(ch), '\0'};
+        Glyph glyph;
+        int32_t advance = find_glyph(canvas->font, ch, glyph) ? glyph.advance : 0;
+        record(canvas, HostCanvasOpGlyph, x, y, advance, static_cast<int32_t>(canvas_current_font_height(canvas)), text);
+        draw_glyph(canvas, x, y, ch);
+    }
+
+    void canvas_draw_dot(Canvas *canvas, int32_t x, int32_t y)
+    {
+        record(canvas, HostCanvasOpDot, x, y, 1, 1);
+        ++canvas->stats.dots;
+        pixel(canvas, x, y);
+    }
+
+    void canvas_draw_box(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height)
+    {
+        record(canvas, HostCanvasOpBox, x, y, static_cast<int32_t>(width), static_cast<int32_t>(height));
+        ++canvas->stats.boxes;
+        fill(canvas, x, y, static_cast<int32_t>(width), static_cast<int32_t>(height));
+    }
+
+    void canvas_draw_rbox(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height, size_t radius)
+    {
+        int32_t w = static_cast<int32_t>(width);
+        int32_t h = static_cast<int32_t>(height);
+        int32_t r = static_cast<int32_t>(radius);
+        record(canvas, HostCanvasOpBox, x, y, w, h);
+        ++canvas->stats.boxes;
+
+        int32_t left = x + r;
+        int32_t top = y + r;
+        int32_t right = x + w - r - 1;
+        int32_t bottom = y + h - r - 1;
+        arc(canvas, left, top, r, UpperLeft, true);
+        arc(canvas, right, top, r, UpperRight, true);
+        arc(canvas, left, bottom, r, LowerLeft, true);
+        arc(canvas, right, bottom, r, LowerRight, true);
+        if (w - 2 * r >= 3)
+        {
+            fill(canvas, left + 1, y, w - 2 * r - 2, r + 1);
+            fill(canvas, left + 1, bottom, w - 2 * r - 2, r + 1);
+        }
+        if (h - 2 * r >= 3)
+        {
+            fill(canvas, x, top + 1, w, h - 2 * r - 2);
+        }
+    }
+
+    void canvas_draw_frame(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height)
+    {
+        int32_t w = static_cast<int32_t>(width);
+        int32_t h = static_cast<int32_t>(height);
+        record(canvas, HostCanvasOpFrame, x, y, w, h);
+        ++canvas->stats.frames;
+        if (w == 0 || h == 0)
+        {
+            return;
+        }
+        hline(canvas, x, y, w);
+        if (h > 1)
+        {
+            hline(canvas, x, y + h - 1, w);
+        }
+        if (h > 2)
+        {
+            vline(canvas, x, y + 1, h - 2);
+            if (w > 1)
+            {
+                vline(canvas, x + w - 1, y + 1, h - 2);
+            }
+        }
+    }
+
+    void canvas_draw_rframe(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height, size_t radius)
+    {
+        int32_t w = static_cast<int32_t>(width);
+        int32_t h = static_cast<int32_t>(height);
+        int32_t r = static_cast<int32_t>(radius);
+        record(canvas, HostCanvasOpFrame, x, y, w, h);
+        ++canvas->stats.frames;
+
+        int32_t left = x + r;
+        int32_t top = y + r;
+        int32_t right = x + w - r - 1;
+        int32_t bottom = y + h - r - 1;
+        arc(canvas, left, top, r, UpperLeft, false);
+        arc(canvas, right, top, r, UpperRight, false);
+        arc(canvas, left, bottom, r, LowerLeft, false);
+        arc(canvas, right, bottom, r, LowerRight, false);
+        if (w - 2 * r >= 3)
+        {
+            hline(canvas, left + 1, y, w - 2 * r - 2);
+            hline(canvas, left + 1, y + h - 1, w - 2 * r - 2);
+        }
+        if (h - 2 * r >= 3)
+        {
+            vline(canvas, x, top + 1, h - 2 * r - 2);
+            vline(canvas, x + w - 1, top + 1, h - 2 * r - 2);
+        }
+    }
+
+    void canvas_draw_line(Canvas *canvas, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+    {
+        record(canvas, HostCanvasOpLine, x1, y1, x2, y2);
+        ++canvas->stats.lines;
+
+        // u8g2's Bresenham, stepping along the longer axis
+        bool steep = std::abs(y2 - y1) > std::abs(x2 - x1);
+        if (steep)
+        {
+            std::swap(x1, y1);
+            std::swap(x2, y2);
+        }
+        if (x1 > x2)
+        {
+            std::swap(x1, x2);
+            std::swap(y1, y2);
+        }
+        int32_t dx = x2 - x1;
+        int32_t dy = std::abs(y2 - y1);
+        int32_t error = dx / 2;
+        int32_t step = y2 > y1 ? 1 : -1;
+        for (int32_t x = x1, y = y1; x <= x2; ++x)
+        {
+            steep ? pixel(canvas, y, x) : pixel(canvas, x, y);
+            error -= dy;
+            if (error < 0)
+            {
+                y += step;
+                error += dx;
+            }
+        }
+    }
+
+    void canvas_draw_xbm(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height, const uint8_t *bitmap)
+    {
+        int32_t w = static_cast<int32_t>(width);
+        int32_t h = static_cast<int32_t>(height);
+        record(canvas, HostCanvasOpXbm, x, y, w, h);
+        ++canvas->stats.bitmaps;
+
+        // XBM rows are whole bytes, least significant bit leftmost; clear
+        // bits are left alone
+        size_t stride = (width + 7) / 8;
+        for (int32_t row = 0; bitmap && row < h; ++row)
+        {
+            for (int32_t column = 0; column < w; ++column)
+            {
+                if (bitmap[row * stride + column / 8] & (1 << (column % 8)))
+                {
+                    pixel(canvas, x + column, y + row);
+                }
+            }
+        }
+    }
+
+    void elements_multiline_text(Canvas *canvas, int32_t x, int32_t y, const char *text)
+    {
+        int32_t height = static_cast<int32_t>(canvas_current_font_height(canvas));
+        char line[128];
+        while (*text)
+        {
+            size_t length = strcspn(text, "\n");
+            snprintf(line, sizeof(line), "%.*s", static_cast<int>(std::min(length, sizeof(line) - 1)), text);
+            canvas_draw_str(canvas, x, y, line);
+            text += length;
+            if (*text == '\n')
+            {
+                ++text;
+            }
+            y += height;
+        }
+    }
+
+    void elements_multiline_text_aligned(Canvas *canvas, int32_t x, int32_t y, Align horizontal, Align vertical, const char *text)
+    {
+        UNUSED(horizontal);
+        UNUSED(vertical);
+        elements_multiline_text(canvas, x, y, text);
+    }
+
+    void elements_slightly_rounded_frame(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height)
+    {
+        canvas_draw_rframe(canvas, x, y, width, height, 1);
+    }
+
+    void elements_slightly_rounded_box(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height)
+    {
+        canvas_draw_rbox(canvas, x, y, width, height, 1);
+    }
+
+    void elements_scrollbar(Canvas *canvas, size_t pos, size_t total)
+    {
+        canvas_draw_frame(canvas, Width - 3, 0, 3, Height);
+        if (total > 0)
+        {
+            size_t block = std::max<size_t>(1, Height / total);
+            canvas_draw_box(canvas, Width - 3, static_cast<int32_t>(pos * (Height - block) / std::max<size_t>(1, total - 1)), 3, block);
+        }
+    }
+
+    void elements_button_left(Canvas *canvas, const char *str)
+    {
+        canvas_draw_str(canvas, 2, Height - 1, str);
+    }
+
+    void elements_button_right(Canvas *canvas, const char *str)
+    {
+        canvas_draw_str_aligned(canvas, Width - 2, Height - 1, AlignRight, AlignBottom, str);
+    }
+
+    void elements_button_center(Canvas *canvas, const char *str)
+    {
+        canvas_draw_str_aligned(canvas, Width / 2, Height - 1, AlignCenter, AlignBottom, str);
+    }
+}
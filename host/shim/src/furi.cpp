@@ -0,0 +1,248 @@
+// Furi core on the host: logging to stderr, records, a manual tick with
+// timers driven by host_advance_ms(), and the fake RTC.
+
+#include <furi.h>
+#include <furi_hal_rtc.h>
+#include <dialogs/dialogs.h>
+#include <gui/gui.h>
+#include <notification/notification.h>
+#include <storage/storage.h>
+
+#include "host_shim.h"
+#include "shim_internal.hpp"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+struct FuriTimer
+{
+    FuriTimerCallback callback;
+    FuriTimerType type;
+    void *context;
+    uint32_t period = 0;
+    uint32_t deadline = 0;
+    bool running = false;
+};
+
+namespace
+{
+    FuriLogLevel logLevel = FuriLogLevelWarn;
+    uint32_t tick = 0;
+    uint32_t busyRemainder = 0; // Microseconds short of the next tick
+    std::vector<FuriTimer *> timers;
+
+    // 2024-01-01 09:00, a Monday; only changes when a test sets it
+    DateTime rtc{9, 0, 0, 1, 1, 2024, 1};
+
+    const char LevelLetters[] = {'?', '-', 'E', 'W', 'I', 'D', 'T'};
+
+    // Records only need distinct non-null handles; the app never looks inside
+    struct DialogsApp
+    {
+        int unused;
+    } dialogs;
+    struct NotificationApp
+    {
+        int unused;
+    } notifications;
+}
+
+// Blocking work (a simulated SD access) takes time but cannot run timers;
+// the ones it makes due fire on the next host_advance_ms()
+void host_busy_us(uint32_t microseconds)
+{
+    uint64_t total = static_cast<uint64_t>(busyRemainder) + microseconds;
+    tick += static_cast<uint32_t>(total / 1000);
+    busyRemainder = static_cast<uint32_t>(total % 1000);
+}
+
+extern "C"
+{
+    void furi_log_print_format(FuriLogLevel level, const char *tag, const char *format, ...)
+    {
+        FuriLogLevel limit = logLevel == FuriLogLevelDefault ? FuriLogLevelInfo : logLevel;
+        if (level > limit || level == FuriLogLevelNone)
+        {
+            return;
+        }
+
+        fprintf(stderr, "%08u [%c][%s] ", static_cast<unsigned>(tick), LevelLetters[level], tag);
+        va_list args;
+        va_start(args, format);
+        vfprintf(stderr, format, args);
+        va_end(args);
+        fputc('\n', stderr);
+    }
+
+    void host_log_set_level(FuriLogLevel level)
+    {
+        logLevel = level;
+    }
+
+    void *furi_record_open(const char *name)
+    {
+        if (strcmp(name, RECORD_STORAGE) == 0)
+        {
+            return host_storage_record();
+        }
+        if (strcmp(name, RECORD_GUI) == 0)
+        {
+            return host_gui_record();
+        }
+        if (strcmp(name, RECORD_DIALOGS) == 0)
+        {
+            return &dialogs;
+        }
+        if (strcmp(name, RECORD_NOTIFICATION) == 0)
+        {
+            return &notifications;
+        }
+        furi_log_print_format(FuriLogLevelError, "shim", "unknown record %s", name);
+        return nullptr;
+    }
+
+    void furi_record_close(const char *name)
+    {
+        UNUSED(name);
+    }
+
+    uint32_t furi_get_tick(void)
+    {
+        return tick;
+    }
+
+    uint32_t furi_kernel_get_tick_frequency(void)
+    {
+        return 1000;
+    }
+
+    uint32_t furi_ms_to_ticks(uint32_t milliseconds)
+    {
+        return milliseconds;
+    }
+
+    void furi_delay_ms(uint32_t milliseconds)
+    {
+        host_advance_ms(milliseconds);
+    }
+
+    void furi_delay_tick(uint32_t ticks)
+    {
+        host_advance_ms(ticks);
+    }
+
+    void host_advance_ms(uint32_t milliseconds)
+    {
+        uint32_t target = tick + milliseconds;
+        for (;;)
+        {
+            // Earliest due timer first; callbacks may start or free timers
+            FuriTimer *next = nullptr;
+            for (FuriTimer *timer : timers)
+            {
+                if (timer->running && timer->deadline <= target && (!next || timer->deadline < next->deadline))
+                {
+                    next = timer;
+                }
+            }
+            if (!next)
+            {
+                break;
+            }
+
+            // Busy time may have carried the tick past the deadline
+            if (next->deadline > tick)
+            {
+                tick = next->deadline;
+            }
+            if (next->type == FuriTimerTypePeriodic)
+            {
+                next->deadline += next->period > 0 ? next->period : 1;
+            }
+            else
+            {
+                next->running = false;
+            }
+            next->callback(next->context);
+            host_pump();
+        }
+        tick = target;
+    }
+
+    FuriTimer *furi_timer_alloc(FuriTimerCallback func, FuriTimerType type, void *context)
+    {
+        auto *timer = new FuriTimer{func, type, context};
+        timers.push_back(timer);
+        return timer;
+    }
+
+    void furi_timer_free(FuriTimer *instance)
+    {
+        for (auto it = timers.begin(); it != timers.end(); ++it)
+        {
+            if (*it == instance)
+            {
+                timers.erase(it);
+                break;
+            }
+        }
+        delete instance;
+    }
+
+    FuriStatus furi_timer_start(FuriTimer *instance, uint32_t ticks)
+    {
+        instance->period = ticks;
+        instance->deadline = tick + ticks;
+        instance->running = true;
+        return FuriStatusOk;
+    }
+
+    FuriStatus furi_timer_restart(FuriTimer *instance, uint32_t ticks)
+    {
+        return furi_timer_start(instance, ticks);
+    }
+
+    FuriStatus furi_timer_stop(FuriTimer *instance)
+    {
+        instance->running = false;
+        return FuriStatusOk;
+    }
+
+    uint32_t furi_timer_is_running(FuriTimer *instance)
+    {
+        return instance->running ? 1 : 0;
+    }
+
+    FuriThreadId furi_thread_get_current_id(void)
+    {
+        return nullptr;
+    }
+
+    uint32_t furi_thread_get_stack_space(FuriThreadId thread_id)
+    {
+        UNUSED(thread_id);
+        return 0;
+    }
+
+    size_t memmgr_get_free_heap(void)
+    {
+        return 0;
+    }
+
+    size_t memmgr_get_minimum_free_heap(void)
+    {
+        return 0;
+    }
+
+    void furi_hal_rtc_get_datetime(DateTime *datetime)
+    {
+        *datetime = rtc;
+    }
+
+    void furi_hal_rtc_set_datetime(DateTime *datetime)
+    {
+        rtc = *datetime;
+    }
+}
@@ -0,0 +1,202 @@
+// FuriString over std::string.
+
+#include <furi/core/string.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+struct FuriString
+{
+    std::string text;
+};
+
+namespace
+{
+    int append_vprintf(std::string &text, const char *format, va_list args)
+    {
+        va_list copy;
+        va_copy(copy, args);
+        int length = vsnprintf(nullptr, 0, format, copy);
+        va_end(copy);
+        if (length < 0)
+        {
+            return length;
+        }
+
+        size_t start = text.size();
+        text.resize(start + static_cast<size_t>(length) + 1);
+        vsnprintf(&text[start], static_cast<size_t>(length) + 1, format, args);
+        text.resize(start + static_cast<size_t>(length));
+        return length;
+    }
+}
+
+extern "C"
+{
+    FuriString *furi_string_alloc(void)
+    {
+        return new FuriString();
+    }
+
+    FuriString *furi_string_alloc_set_str(const char cstr_source[])
+    {
+        return new FuriString{cstr_source};
+    }
+
+    FuriString *furi_string_alloc_copy(const FuriString *source)
+    {
+        return new FuriString{source->text};
+    }
+
+    FuriString *furi_string_alloc_printf(const char format[], ...)
+    {
+        FuriString *string = furi_string_alloc();
+        va_list args;
+        va_start(args, format);
+        append_vprintf(string->text, format, args);
+        va_end(args);
+        return string;
+    }
+
+    void furi_string_free(FuriString *string)
+    {
+        delete string;
+    }
+
+    void furi_string_reset(FuriString *string)
+    {
+        string->text.clear();
+    }
+
+    void furi_string_reserve(FuriString *string, size_t size)
+    {
+        string->text.reserve(size);
+    }
+
+    size_t furi_string_size(const FuriString *string)
+    {
+        return string->text.size();
+    }
+
+    bool furi_string_empty(const FuriString *string)
+    {
+        return string->text.empty();
+    }
+
+    const char *furi_string_get_cstr(const FuriString *string)
+    {
+        return string->text.c_str();
+    }
+
+    char furi_string_get_char(const FuriString *string, size_t index)
+    {
+        return string->text.at(index);
+    }
+
+    void furi_string_set_char(FuriString *string, size_t index, const char c)
+    {
+        string->text.at(index) = c;
+    }
+
+    void furi_string_set_str(FuriString *string, const char cstr[])
+    {
+        string->text = cstr;
+    }
+
+    void furi_string_set_strn(FuriString *string, const char cstr[], size_t n)
+    {
+        string->text.assign(cstr, strnlen(cstr, n));
+    }
+
+    void furi_string_set_copy(FuriString *string, const FuriString *source)
+    {
+        string->text = source->text;
+    }
+
+    void furi_string_push_back(FuriString *string, char c)
+    {
+        string->text.push_back(c);
+    }
+
+    void furi_string_cat_str(FuriString *string, const char cstr[])
+    {
+        string->text += cstr;
+    }
+
+    void furi_string_cat_copy(FuriString *string, const FuriString *other)
+    {
+        string->text += other->text;
+    }
+
+    int furi_string_printf(FuriString *string, const char format[], ...)
+    {
+        string->text.clear();
+        va_list args;
+        va_start(args, format);
+        int result = append_vprintf(string->text, format, args);
+        va_end(args);
+        return result;
+    }
+
+    int furi_string_vprintf(FuriString *string, const char format[], va_list args)
+    {
+        string->text.clear();
+        return append_vprintf(string->text, format, args);
+    }
+
+    int furi_string_cat_printf(FuriString *string, const char format[], ...)
+    {
+        va_list args;
+        va_start(args, format);
+        int result = append_vprintf(string->text, format, args);
+        va_end(args);
+        return result;
+    }
+
+    int furi_string_cat_vprintf(FuriString *string, const char format[], va_list args)
+    {
+        return append_vprintf(string->text, format, args);
+    }
+
+    int furi_string_cmp_str(const FuriString *string, const char cstring[])
+    {
+        return strcmp(string->text.c_str(), cstring);
+    }
+
+    int furi_string_cmp_copy(const FuriString *string, const FuriString *other)
+    {
+        return string->text.compare(other->text);
+    }
+
+    void furi_string_mid(FuriString *string, size_t start, size_t length)
+    {
+        string->text = start < string->text.size() ? string->text.substr(start, length) : std::string();
+    }
+
+    void furi_string_left(FuriString *string, size_t index)
+    {
+        if (index < string->text.size())
+        {
+            string->text.resize(index);
+        }
+    }
+
+    void furi_string_right(FuriString *string, size_t index)
+    {
+        string->text.erase(0, index < string->text.size() ? index : string->text.size());
+    }
+
+    size_t furi_string_search_char(const FuriString *string, char c, size_t start)
+    {
+        size_t found = string->text.find(c, start);
+        return found == std::string::npos ? FURI_STRING_FAILURE : found;
+    }
+
+    size_t furi_string_search_str(const FuriString *string, const char search[], size_t start)
+    {
+        size_t found = string->text.find(search, start);
+        return found == std::string::npos ? FURI_STRING_FAILURE : found;
+    }
+}
@@ -0,0 +1,425 @@
+// GUI on the host: view ports, views and a view dispatcher whose event loop
+// is pumped by the harness instead of a thread.
+
+#include <gui/gui.h>
+#include <gui/view.h>
+#include <gui/view_dispatcher.h>
+#include <gui/view_port.h>
+
+#include "host_shim.h"
+#include "shim_internal.hpp"
+
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <vector>
+
+struct ViewPort
+{
+    ViewPortDrawCallback draw = nullptr;
+    void *drawContext = nullptr;
+    ViewPortInputCallback input = nullptr;
+    void *inputContext = nullptr;
+    bool enabled = true;
+};
+
+struct View
+{
+    ViewDrawCallback draw = nullptr;
+    ViewInputCallback input = nullptr;
+    ViewCustomCallback custom = nullptr;
+    ViewNavigationCallback previous = nullptr;
+    ViewCallback enter = nullptr;
+    ViewCallback exit = nullptr;
+    void *context = nullptr;
+    void *model = nullptr;
+};
+
+struct ViewDispatcher
+{
+    std::map<uint32_t, View *> views;
+    uint32_t current = VIEW_NONE;
+    std::deque<uint32_t> events;
+    ViewDispatcherCustomEventCallback custom = nullptr;
+    ViewDispatcherNavigationEventCallback navigation = nullptr;
+    void *context = nullptr;
+    bool stopped = false;
+};
+
+struct Gui
+{
+    std::vector<ViewPort *> ports;
+};
+
+namespace
+{
+    Gui gui;
+    ViewDispatcher *latest = nullptr;
+    Canvas *screen = nullptr;
+
+    View *current_view(ViewDispatcher *dispatcher)
+    {
+        auto found = dispatcher ? dispatcher->views.find(dispatcher->current) : std::map<uint32_t, View *>::iterator();
+        return dispatcher && found != dispatcher->views.end() ? found->second : nullptr;
+    }
+
+    // The topmost enabled view port covers the dispatcher's view
+    ViewPort *top_port()
+    {
+        for (auto port = gui.ports.rbegin(); port != gui.ports.rend(); ++port)
+        {
+            if ((*port)->enabled)
+            {
+                return *port;
+            }
+        }
+        return nullptr;
+    }
+}
+
+Gui *host_gui_record()
+{
+    return &gui;
+}
+
+extern "C"
+{
+    void gui_add_view_port(Gui *instance, ViewPort *view_port, GuiLayer layer)
+    {
+        UNUSED(layer);
+        instance->ports.push_back(view_port);
+    }
+
+    void gui_remove_view_port(Gui *instance, ViewPort *view_port)
+    {
+        for (auto port = instance->ports.begin(); port != instance->ports.end(); ++port)
+        {
+            if (*port == view_port)
+            {
+                instance->ports.erase(port);
+                break;
+            }
+        }
+    }
+
+    ViewPort *view_port_alloc(void)
+    {
+        return new ViewPort();
+    }
+
+    void view_port_free(ViewPort *view_port)
+    {
+        gui_remove_view_port(&gui, view_port);
+        delete view_port;
+    }
+
+    void view_port_enabled_set(ViewPort *view_port, bool enabled)
+    {
+        view_port->enabled = enabled;
+    }
+
+    void view_port_draw_callback_set(ViewPort *view_port, ViewPortDrawCallback callback, void *context)
+    {
+        view_port->draw = callback;
+        view_port->drawContext = context;
+    }
+
+    void view_port_input_callback_set(ViewPort *view_port, ViewPortInputCallback callback, void *context)
+    {
+        view_port->input = callback;
+        view_port->inputContext = context;
+    }
+
+    void view_port_update(ViewPort *view_port)
+    {
+        // Frames are only drawn when the harness asks for one
+        UNUSED(view_port);
+    }
+
+    View *view_alloc(void)
+    {
+        return new View();
+    }
+
+    void view_free(View *view)
+    {
+        view_free_model(view);
+        delete view;
+    }
+
+    void view_tie_icon_animation(View *view, void *icon_animation)
+    {
+        UNUSED(view);
+        UNUSED(icon_animation);
+    }
+
+    void view_set_draw_callback(View *view, ViewDrawCallback callback)
+    {
+        view->draw = callback;
+    }
+
+    void view_set_input_callback(View *view, ViewInputCallback callback)
+    {
+        view->input = callback;
+    }
+
+    void view_set_custom_callback(View *view, ViewCustomCallback callback)
+    {
+        view->custom = callback;
+    }
+
+    void view_set_previous_callback(View *view, ViewNavigationCallback callback)
+    {
+        view->previous = callback;
+    }
+
+    void view_set_enter_callback(View *view, ViewCallback callback)
+    {
+        view->enter = callback;
+    }
+
+    void view_set_exit_callback(View *view, ViewCallback callback)
+    {
+        view->exit = callback;
+    }
+
+    void view_set_context(View *view, void *context)
+    {
+        view->context = context;
+    }
+
+    void view_allocate_model(View *view, ViewModelType type, size_t size)
+    {
+        UNUSED(type);
+        view_free_model(view);
+        view->model = calloc(1, size);
+    }
+
+    void view_free_model(View *view)
+    {
+        free(view->model);
+        view->model = nullptr;
+    }
+
+    void *view_get_model(View *view)
+    {
+        return view->model;
+    }
+
+    void view_commit_model(View *view, bool update)
+    {
+        UNUSED(view);
+        UNUSED(update);
+    }
+
+    ViewDispatcher *view_dispatcher_alloc(void)
+    {
+        latest = new ViewDispatcher();
+        return latest;
+    }
+
+    void view_dispatcher_free(ViewDispatcher *view_dispatcher)
+    {
+        if (latest == view_dispatcher)
+        {
+            latest = nullptr;
+        }
+        delete view_dispatcher;
+    }
+
+    void view_dispatcher_enable_queue(ViewDispatcher *view_dispatcher)
+    {
+        UNUSED(view_dispatcher);
+    }
+
+    void view_dispatcher_send_custom_event(ViewDispatcher *view_dispatcher, uint32_t event)
+    {
+        view_dispatcher->events.push_back(event);
+    }
+
+    void view_dispatcher_set_custom_event_callback(ViewDispatcher *view_dispatcher, ViewDispatcherCustomEventCallback callback)
+    {
+        view_dispatcher->custom = callback;
+    }
+
+    void view_dispatcher_set_navigation_event_callback(ViewDispatcher *view_dispatcher, ViewDispatcherNavigationEventCallback callback)
+    {
+        view_dispatcher->navigation = callback;
+    }
+
+    void view_dispatcher_set_tick_event_callback(ViewDispatcher *view_dispatcher, ViewDispatcherTickEventCallback callback, uint32_t tick_period)
+    {
+        UNUSED(view_dispatcher);
+        UNUSED(callback);
+        UNUSED(tick_period);
+    }
+
+    void view_dispatcher_set_event_callback_context(ViewDispatcher *view_dispatcher, void *context)
+    {
+        view_dispatcher->context = context;
+    }
+
+    void view_dispatcher_run(ViewDispatcher *view_dispatcher)
+    {
+        // Returns once the queue is empty; the harness keeps feeding it
+        UNUSED(view_dispatcher);
+        host_pump();
+    }
+
+    void view_dispatcher_stop(ViewDispatcher *view_dispatcher)
+    {
+        view_dispatcher->stopped = true;
+    }
+
+    void view_dispatcher_add_view(ViewDispatcher *view_dispatcher, uint32_t view_id, View *view)
+    {
+        furi_check(view_dispatcher->views.count(view_id) == 0);
+        view_dispatcher->views[view_id] = view;
+    }
+
+    void view_dispatcher_remove_view(ViewDispatcher *view_dispatcher, uint32_t view_id)
+    {
+        if (view_dispatcher->current == view_id)
+        {
+            view_dispatcher->current = VIEW_NONE;
+        }
+        view_dispatcher->views.erase(view_id);
+    }
+
+    void view_dispatcher_switch_to_view(ViewDispatcher *view_dispatcher, uint32_t view_id)
+    {
+        furi_check(view_dispatcher->views.count(view_id) == 1);
+        View *previous = current_view(view_dispatcher);
+        if (previous && previous->exit)
+        {
+            previous->exit(previous->context);
+        }
+        view_dispatcher->current = view_id;
+        View *next = current_view(view_dispatcher);
+        if (next->enter)
+        {
+            next->enter(next->context);
+        }
+    }
+
+    void view_dispatcher_attach_to_gui(ViewDispatcher *view_dispatcher, Gui *instance, ViewDispatcherType type)
+    {
+        UNUSED(view_dispatcher);
+        UNUSED(instance);
+        UNUSED(type);
+    }
+
+    void host_pump(void)
+    {
+        ViewDispatcher *dispatcher = latest;
+        while (dispatcher && !dispatcher->events.empty())
+        {
+            uint32_t event = dispatcher->events.front();
+            dispatcher->events.pop_front();
+
+            // The current view sees custom events before the dispatcher
+            View *view = current_view(dispatcher);
+            if (view && view->custom && view->custom(event, view->context))
+            {
+                continue;
+            }
+            if (dispatcher->custom)
+            {
+                dispatcher->custom(dispatcher->context, event);
+            }
+        }
+    }
+
+    void host_send_input(InputKey key, InputType type)
+    {
+        InputEvent event{0, key, type};
+        if (ViewPort *port = top_port())
+        {
+            if (port->input)
+            {
+                port->input(&event, port->inputContext);
+            }
+            host_pump();
+            return;
+        }
+
+        ViewDispatcher *dispatcher = latest;
+        View *view = current_view(dispatcher);
+        if (!view)
+        {
+            return;
+        }
+
+        bool consumed = view->input && view->input(&event, view->context);
+        if (!consumed && key == InputKeyBack && type == InputTypeShort)
+        {
+            uint32_t next = view->previous ? view->previous(view->context) : VIEW_IGNORE;
+            if (next == VIEW_NONE)
+            {
+                if (!dispatcher->navigation || !dispatcher->navigation(dispatcher->context))
+                {
+                    view_dispatcher_stop(dispatcher);
+                }
+            }
+            else if (next != VIEW_IGNORE)
+            {
+                view_dispatcher_switch_to_view(dispatcher, next);
+            }
+        }
+        host_pump();
+    }
+
+    void host_press(InputKey key)
+    {
+        host_send_input(key, InputTypePress);
+        host_send_input(key, InputTypeShort);
+        host_send_input(key, InputTypeRelease);
+    }
+
+    void host_long_press(InputKey key)
+    {
+        host_send_input(key, InputTypePress);
+        host_send_input(key, InputTypeLong);
+        host_send_input(key, InputTypeRelease);
+    }
+
+    Canvas *host_render(void)
+    {
+        if (!screen)
+        {
+            screen = host_canvas_alloc();
+        }
+        canvas_reset(screen);
+
+        if (ViewPort *port = top_port())
+        {
+            if (port->draw)
+            {
+                port->draw(screen, port->drawContext);
+            }
+        }
+        else if (View *view = current_view(latest))
+        {
+            if (view->draw)
+            {
+                view->draw(screen, view->model);
+            }
+        }
+        return screen;
+    }
+
+    ViewDispatcher *host_view_dispatcher(void)
+    {
+        return latest;
+    }
+
+    uint32_t host_current_view(void)
+    {
+        return latest ? latest->current : VIEW_NONE;
+    }
+
+    bool host_dispatcher_stopped(void)
+    {
+        return latest && latest->stopped;
+    }
+}
@@ -0,0 +1,824 @@
+// GUI modules on the host. Each module owns a view whose model points back
+// at it; they draw plain text rows and handle the same keys as on device.
+
+#include <dialogs/dialogs.h>
+#include <gui/elements.h>
+#include <gui/modules/dialog_ex.h>
+#include <gui/modules/loading.h>
+#include <gui/modules/menu.h>
+#include <gui/modules/popup.h>
+#include <gui/modules/submenu.h>
+#include <gui/modules/text_box.h>
+#include <gui/modules/text_input.h>
+#include <gui/modules/variable_item_list.h>
+#include <gui/modules/widget.h>
+
+#include "host_shim.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t VisibleRows = 4;
+
+    // Points the view's model at the module and routes input to it
+    template <typename Module>
+    View *module_view(Module *module, ViewDrawCallback draw, ViewInputCallback input)
+    {
+        View *view = view_alloc();
+        view_allocate_model(view, ViewModelTypeLockFree, sizeof(Module *));
+        *static_cast<Module **>(view_get_model(view)) = module;
+        view_set_context(view, module);
+        view_set_draw_callback(view, draw);
+        if (input)
+        {
+            view_set_input_callback(view, input);
+        }
+        return view;
+    }
+
+    template <typename Module>
+    Module *model_module(void *model)
+    {
+        return *static_cast<Module **>(model);
+    }
+
+    bool is_press(const InputEvent *event)
+    {
+        return event->type == InputTypeShort || event->type == InputTypeRepeat;
+    }
+
+    std::string text_or_empty(const char *text)
+    {
+        return text ? text : "";
+    }
+}
+
+struct SubmenuItem
+{
+    std::string label;
+    uint32_t index;
+    SubmenuItemCallback callback;
+    void *context;
+};
+
+struct Submenu
+{
+    View *view = nullptr;
+    std::string header;
+    std::vector<SubmenuItem> items;
+    size_t selected = 0;
+};
+
+struct VariableItem
+{
+    std::string label;
+    std::string valueText;
+    uint8_t valuesCount = 0;
+    uint8_t index = 0;
+    VariableItemChangeCallback callback = nullptr;
+    void *context = nullptr;
+};
+
+struct VariableItemList
+{
+    View *view = nullptr;
+    std::vector<VariableItem *> items;
+    size_t selected = 0;
+    VariableItemListEnterCallback enter = nullptr;
+    void *enterContext = nullptr;
+};
+
+struct Widget
+{
+    View *view = nullptr;
+    std::string text;
+};
+
+struct Popup
+{
+    View *view = nullptr;
+    std::string header;
+    std::string text;
+    PopupCallback callback = nullptr;
+    void *context = nullptr;
+};
+
+struct DialogEx
+{
+    View *view = nullptr;
+    std::string header;
+    std::string text;
+    std::string buttons[3];
+    DialogExResultCallback callback = nullptr;
+    void *context = nullptr;
+};
+
+struct Loading
+{
+    View *view = nullptr;
+};
+
+struct Menu
+{
+    View *view = nullptr;
+};
+
+struct TextInput
+{
+    View *view = nullptr;
+    std::string header;
+    TextInputCallback callback = nullptr;
+    void *context = nullptr;
+    char *buffer = nullptr;
+    size_t bufferSize = 0;
+};
+
+struct TextBox
+{
+    View *view = nullptr;
+    std::string text;
+};
+
+struct DialogMessage
+{
+    std::string header;
+    std::string text;
+};
+
+namespace
+{
+    std::string lastDialogHeader;
+    std::string lastDialogText;
+
+    void submenu_draw(Canvas *canvas, void *model)
+    {
+        Submenu *submenu = model_module<Submenu>(model);
+        canvas_clear(canvas);
+        canvas_set_font(canvas, FontPrimary);
+        canvas_draw_str(canvas, 2, 10, submenu->header.c_str());
+        canvas_set_font(canvas, FontSecondary);
+        size_t first = submenu->selected - submenu->selected % VisibleRows;
+        for (size_t row = 0; row < VisibleRows && first + row < submenu->items.size(); ++row)
+        {
+            int32_t y = static_cast<int32_t>(22 + row * 12);
+            if (first + row == submenu->selected)
+            {
+                canvas_draw_box(canvas, 0, y - 9, 123, 12);
+                canvas_set_color(canvas, ColorWhite);
+            }
+            canvas_draw_str(canvas, 6, y, submenu->items[first + row].label.c_str());
+            canvas_set_color(canvas, ColorBlack);
+        }
+    }
+
+    bool submenu_input(InputEvent *event, void *context)
+    {
+        auto *submenu = static_cast<Submenu *>(context);
+        if (!is_press(event) || submenu->items.empty())
+        {
+            return false;
+        }
+
+        size_t count = submenu->items.size();
+        switch (event->key)
+        {
+        case InputKeyUp:
+            submenu->selected = (submenu->selected + count - 1) % count;
+            return true;
+        case InputKeyDown:
+            submenu->selected = (submenu->selected + 1) % count;
+            return true;
+        case InputKeyOk:
+            if (event->type == InputTypeShort)
+            {
+                const SubmenuItem &item = submenu->items[submenu->selected];
+                if (item.callback)
+                {
+                    item.callback(item.context, item.index);
+                }
+            }
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void variable_item_list_draw(Canvas *canvas, void *model)
+    {
+        VariableItemList *list = model_module<VariableItemList>(model);
+        canvas_clear(canvas);
+        canvas_set_font(canvas, FontSecondary);
+        size_t first = list->selected - list->selected % VisibleRows;
+        for (size_t row = 0; row < VisibleRows && first + row < list->items.size(); ++row)
+        {
+            const VariableItem *item = list->items[first + row];
+            int32_t y = static_cast<int32_t>(10 + row * 16);
+            if (first + row == list->selected)
+            {
+                canvas_draw_box(canvas, 0, y - 9, 123, 15);
+                canvas_set_color(canvas, ColorWhite);
+            }
+            canvas_draw_str(canvas, 6, y, item->label.c_str());
+            canvas_draw_str_aligned(canvas, 120, y, AlignRight, AlignBottom, item->valueText.c_str());
+            canvas_set_color(canvas, ColorBlack);
+        }
+        elements_scrollbar(canvas, list->selected, list->items.size());
+    }
+
+    bool variable_item_list_input(InputEvent *event, void *context)
+    {
+        auto *list = static_cast<VariableItemList *>(context);
+        if (!is_press(event) || list->items.empty())
+        {
+            return false;
+        }
+
+        size_t count = list->items.size();
+        VariableItem *item = list->items[list->selected];
+        switch (event->key)
+        {
+        case InputKeyUp:
+            list->selected = (list->selected + count - 1) % count;
+            return true;
+        case InputKeyDown:
+            list->selected = (list->selected + 1) % count;
+            return true;
+        case InputKeyLeft:
+            if (item->index > 0)
+            {
+                --item->index;
+                if (item->callback)
+                {
+                    item->callback(item);
+                }
+            }
+            return true;
+        case InputKeyRight:
+            if (item->index + 1 < item->valuesCount)
+            {
+                ++item->index;
+                if (item->callback)
+                {
+                    item->callback(item);
+                }
+            }
+            return true;
+        case InputKeyOk:
+            if (event->type == InputTypeShort && list->enter)
+            {
+                list->enter(list->enterContext, static_cast<uint32_t>(list->selected));
+            }
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void text_draw(Canvas *canvas, const std::string &header, const std::string &text)
+    {
+        canvas_clear(canvas);
+        if (!header.empty())
+        {
+            canvas_set_font(canvas, FontPrimary);
+            canvas_draw_str(canvas, 2, 10, header.c_str());
+        }
+        canvas_set_font(canvas, FontSecondary);
+        elements_multiline_text(canvas, 2, header.empty() ? 10 : 22, text.c_str());
+    }
+
+    void widget_draw(Canvas *canvas, void *model)
+    {
+        text_draw(canvas, "", model_module<Widget>(model)->text);
+    }
+
+    void popup_draw(Canvas *canvas, void *model)
+    {
+        Popup *popup = model_module<Popup>(model);
+        text_draw(canvas, popup->header, popup->text);
+    }
+
+    void dialog_ex_draw(Canvas *canvas, void *model)
+    {
+        DialogEx *dialog = model_module<DialogEx>(model);
+        text_draw(canvas, dialog->header, dialog->text);
+        if (!dialog->buttons[0].empty())
+        {
+            elements_button_left(canvas, dialog->buttons[0].c_str());
+        }
+        if (!dialog->buttons[1].empty())
+        {
+            elements_button_center(canvas, dialog->buttons[1].c_str());
+        }
+        if (!dialog->buttons[2].empty())
+        {
+            elements_button_right(canvas, dialog->buttons[2].c_str());
+        }
+    }
+
+    bool dialog_ex_input(InputEvent *event, void *context)
+    {
+        auto *dialog = static_cast<DialogEx *>(context);
+        if (event->type != InputTypeShort || !dialog->callback)
+        {
+            return false;
+        }
+        switch (event->key)
+        {
+        case InputKeyLeft:
+            dialog->callback(DialogExResultLeft, dialog->context);
+            return true;
+        case InputKeyOk:
+            dialog->callback(DialogExResultCenter, dialog->context);
+            return true;
+        case InputKeyRight:
+            dialog->callback(DialogExResultRight, dialog->context);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void loading_draw(Canvas *canvas, void *)
+    {
+        canvas_clear(canvas);
+        canvas_draw_str(canvas, 40, 32, "Loading...");
+    }
+
+    void menu_draw(Canvas *canvas, void *)
+    {
+        canvas_clear(canvas);
+    }
+
+    void text_input_draw(Canvas *canvas, void *model)
+    {
+        TextInput *input = model_module<TextInput>(model);
+        text_draw(canvas, input->header, input->buffer ? input->buffer : "");
+    }
+
+    bool text_input_input(InputEvent *event, void *context)
+    {
+        // Typing is not simulated: OK accepts the buffer as it stands
+        auto *input = static_cast<TextInput *>(context);
+        if (event->type == InputTypeShort && event->key == InputKeyOk && input->callback)
+        {
+            input->callback(input->context);
+            return true;
+        }
+        return false;
+    }
+
+    void text_box_draw(Canvas *canvas, void *model)
+    {
+        text_draw(canvas, "", model_module<TextBox>(model)->text);
+    }
+}
+
+extern "C"
+{
+    Submenu *submenu_alloc(void)
+    {
+        auto *submenu = new Submenu();
+        submenu->view = module_view(submenu, submenu_draw, submenu_input);
+        return submenu;
+    }
+
+    void submenu_free(Submenu *submenu)
+    {
+        view_free(submenu->view);
+        delete submenu;
+    }
+
+    View *submenu_get_view(Submenu *submenu)
+    {
+        return submenu->view;
+    }
+
+    void submenu_add_item(Submenu *submenu, const char *label, uint32_t index, SubmenuItemCallback callback, void *callback_context)
+    {
+        submenu->items.push_back(SubmenuItem{text_or_empty(label), index, callback, callback_context});
+    }
+
+    void submenu_reset(Submenu *submenu)
+    {
+        submenu->items.clear();
+        submenu->selected = 0;
+        submenu->header.clear();
+    }
+
+    void submenu_set_selected_item(Submenu *submenu, uint32_t index)
+    {
+        for (size_t i = 0; i < submenu->items.size(); ++i)
+        {
+            if (submenu->items[i].index == index)
+            {
+                submenu->selected = i;
+            }
+        }
+    }
+
+    void submenu_set_header(Submenu *submenu, const char *header)
+    {
+        submenu->header = text_or_empty(header);
+    }
+
+    VariableItemList *variable_item_list_alloc(void)
+    {
+        auto *list = new VariableItemList();
+        list->view = module_view(list, variable_item_list_draw, variable_item_list_input);
+        return list;
+    }
+
+    void variable_item_list_free(VariableItemList *variable_item_list)
+    {
+        variable_item_list_reset(variable_item_list);
+        view_free(variable_item_list->view);
+        delete variable_item_list;
+    }
+
+    void variable_item_list_reset(VariableItemList *variable_item_list)
+    {
+        for (VariableItem *item : variable_item_list->items)
+        {
+            delete item;
+        }
+        variable_item_list->items.clear();
+        variable_item_list->selected = 0;
+    }
+
+    View *variable_item_list_get_view(VariableItemList *variable_item_list)
+    {
+        return variable_item_list->view;
+    }
+
+    VariableItem *variable_item_list_add(VariableItemList *variable_item_list, const char *label, uint8_t values_count, VariableItemChangeCallback change_callback, void *context)
+    {
+        auto *item = new VariableItem();
+        item->label = text_or_empty(label);
+        item->valuesCount = values_count;
+        item->callback = change_callback;
+        item->context = context;
+        variable_item_list->items.push_back(item);
+        return item;
+    }
+
+    void variable_item_list_set_enter_callback(VariableItemList *variable_item_list, VariableItemListEnterCallback callback, void *context)
+    {
+        variable_item_list->enter = callback;
+        variable_item_list->enterContext = context;
+    }
+
+    void variable_item_list_set_selected_item(VariableItemList *variable_item_list, uint8_t index)
+    {
+        if (index < variable_item_list->items.size())
+        {
+            variable_item_list->selected = index;
+        }
+    }
+
+    uint8_t variable_item_list_get_selected_item_index(VariableItemList *variable_item_list)
+    {
+        return static_cast<uint8_t>(variable_item_list->selected);
+    }
+
+    void variable_item_set_current_value_index(VariableItem *item, uint8_t current_value_index)
+    {
+        item->index = current_value_index;
+    }
+
+    void variable_item_set_values_count(VariableItem *item, uint8_t values_count)
+    {
+        item->valuesCount = values_count;
+    }
+
+    void variable_item_set_current_value_text(VariableItem *item, const char *current_value_text)
+    {
+        item->valueText = text_or_empty(current_value_text);
+    }
+
+    uint8_t variable_item_get_current_value_index(VariableItem *item)
+    {
+        return item->index;
+    }
+
+    void *variable_item_get_context(VariableItem *item)
+    {
+        return item->context;
+    }
+
+    size_t variable_item_list_host_count(VariableItemList *variable_item_list)
+    {
+        return variable_item_list->items.size();
+    }
+
+    VariableItem *variable_item_list_host_item(VariableItemList *variable_item_list, size_t index)
+    {
+        return index < variable_item_list->items.size() ? variable_item_list->items[index] : nullptr;
+    }
+
+    const char *variable_item_host_label(VariableItem *item)
+    {
+        return item->label.c_str();
+    }
+
+    const char *variable_item_host_value_text(VariableItem *item)
+    {
+        return item->valueText.c_str();
+    }
+
+    Widget *widget_alloc(void)
+    {
+        auto *widget = new Widget();
+        widget->view = module_view(widget, widget_draw, nullptr);
+        return widget;
+    }
+
+    void widget_free(Widget *widget)
+    {
+        view_free(widget->view);
+        delete widget;
+    }
+
+    void widget_reset(Widget *widget)
+    {
+        widget->text.clear();
+    }
+
+    View *widget_get_view(Widget *widget)
+    {
+        return widget->view;
+    }
+
+    void widget_add_text_scroll_element(Widget *widget, uint8_t x, uint8_t y, uint8_t width, uint8_t height, const char *text)
+    {
+        UNUSED(x);
+        UNUSED(y);
+        UNUSED(width);
+        UNUSED(height);
+        widget->text = text_or_empty(text);
+    }
+
+    const char *widget_host_text(Widget *widget)
+    {
+        return widget->text.c_str();
+    }
+
+    Popup *popup_alloc(void)
+    {
+        auto *popup = new Popup();
+        popup->view = module_view(popup, popup_draw, nullptr);
+        return popup;
+    }
+
+    void popup_free(Popup *popup)
+    {
+        view_free(popup->view);
+        delete popup;
+    }
+
+    View *popup_get_view(Popup *popup)
+    {
+        return popup->view;
+    }
+
+    void popup_set_callback(Popup *popup, PopupCallback callback)
+    {
+        popup->callback = callback;
+    }
+
+    void popup_set_context(Popup *popup, void *context)
+    {
+        popup->context = context;
+    }
+
+    void popup_set_header(Popup *popup, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical)
+    {
+        UNUSED(x);
+        UNUSED(y);
+        UNUSED(horizontal);
+        UNUSED(vertical);
+        popup->header = text_or_empty(text);
+    }
+
+    void popup_set_text(Popup *popup, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical)
+    {
+        UNUSED(x);
+        UNUSED(y);
+        UNUSED(horizontal);
+        UNUSED(vertical);
+        popup->text = text_or_empty(text);
+    }
+
+    DialogEx *dialog_ex_alloc(void)
+    {
+        auto *dialog = new DialogEx();
+        dialog->view = module_view(dialog, dialog_ex_draw, dialog_ex_input);
+        return dialog;
+    }
+
+    void dialog_ex_free(DialogEx *dialog_ex)
+    {
+        view_free(dialog_ex->view);
+        delete dialog_ex;
+    }
+
+    View *dialog_ex_get_view(DialogEx *dialog_ex)
+    {
+        return dialog_ex->view;
+    }
+
+    void dialog_ex_set_result_callback(DialogEx *dialog_ex, DialogExResultCallback callback)
+    {
+        dialog_ex->callback = callback;
+    }
+
+    void dialog_ex_set_context(DialogEx *dialog_ex, void *context)
+    {
+        dialog_ex->context = context;
+    }
+
+    void dialog_ex_set_header(DialogEx *dialog_ex, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical)
+    {
+        UNUSED(x);
+        UNUSED(y);
+        UNUSED(horizontal);
+        UNUSED(vertical);
+        dialog_ex->header = text_or_empty(text);
+    }
+
+    void dialog_ex_set_text(DialogEx *dialog_ex, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical)
+    {
+        UNUSED(x);
+        UNUSED(y);
+        UNUSED(horizontal);
+        UNUSED(vertical);
+        dialog_ex->text = text_or_empty(text);
+    }
+
+    void dialog_ex_set_left_button_text(DialogEx *dialog_ex, const char *text)
+    {
+        dialog_ex->buttons[0] = text_or_empty(text);
+    }
+
+    void dialog_ex_set_center_button_text(DialogEx *dialog_ex, const char *text)
+    {
+        dialog_ex->buttons[1] = text_or_empty(text);
+    }
+
+    void dialog_ex_set_right_button_text(DialogEx *dialog_ex, const char *text)
+    {
+        dialog_ex->buttons[2] = text_or_empty(text);
+    }
+
+    Loading *loading_alloc(void)
+    {
+        auto *loading = new Loading();
+        loading->view = module_view(loading, loading_draw, nullptr);
+        return loading;
+    }
+
+    void loading_free(Loading *loading)
+    {
+        view_free(loading->view);
+        delete loading;
+    }
+
+    View *loading_get_view(Loading *loading)
+    {
+        return loading->view;
+    }
+
+    Menu *menu_alloc(void)
+    {
+        auto *menu = new Menu();
+        menu->view = module_view(menu, menu_draw, nullptr);
+        return menu;
+    }
+
+    void menu_free(Menu *menu)
+    {
+        view_free(menu->view);
+        delete menu;
+    }
+
+    View *menu_get_view(Menu *menu)
+    {
+        return menu->view;
+    }
+
+    TextInput *text_input_alloc(void)
+    {
+        auto *input = new TextInput();
+        input->view = module_view(input, text_input_draw, text_input_input);
+        return input;
+    }
+
+    void text_input_free(TextInput *text_input)
+    {
+        view_free(text_input->view);
+        delete text_input;
+    }
+
+    View *text_input_get_view(TextInput *text_input)
+    {
+        return text_input->view;
+    }
+
+    void text_input_set_result_callback(TextInput *text_input, TextInputCallback callback, void *callback_context, char *text_buffer, size_t text_buffer_size, bool clear_default_text)
+    {
+        text_input->callback = callback;
+        text_input->context = callback_context;
+        text_input->buffer = text_buffer;
+        text_input->bufferSize = text_buffer_size;
+        if (clear_default_text && text_buffer && text_buffer_size > 0)
+        {
+            text_buffer[0] = '\0';
+        }
+    }
+
+    void text_input_set_header_text(TextInput *text_input, const char *text)
+    {
+        text_input->header = text_or_empty(text);
+    }
+
+    TextBox *text_box_alloc(void)
+    {
+        auto *box = new TextBox();
+        box->view = module_view(box, text_box_draw, nullptr);
+        return box;
+    }
+
+    void text_box_free(TextBox *text_box)
+    {
+        view_free(text_box->view);
+        delete text_box;
+    }
+
+    View *text_box_get_view(TextBox *text_box)
+    {
+        return text_box->view;
+    }
+
+    void text_box_set_text(TextBox *text_box, const char *text)
+    {
+        text_box->text = text_or_empty(text);
+    }
+
+    DialogMessage *dialog_message_alloc(void)
+    {
+        return new DialogMessage();
+    }
+
+    void dialog_message_free(DialogMessage *message)
+    {
+        delete message;
+    }
+
+    void dialog_message_set_header(DialogMessage *message, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical)
+    {
+        UNUSED(x);
+        UNUSED(y);
+        UNUSED(horizontal);
+        UNUSED(vertical);
+        message->header = text_or_empty(text);
+    }
+
+    void dialog_message_set_text(DialogMessage *message, const char *text, uint8_t x, uint8_t y, Align horizontal, Align vertical)
+    {
+        UNUSED(x);
+        UNUSED(y);
+        UNUSED(horizontal);
+        UNUSED(vertical);
+        message->text = text_or_empty(text);
+    }
+
+    void dialog_message_set_buttons(DialogMessage *message, const char *left, const char *center, const char *right)
+    {
+        UNUSED(message);
+        UNUSED(left);
+        UNUSED(center);
+        UNUSED(right);
+    }
+
+    DialogMessageButton dialog_message_show(DialogsApp *context, const DialogMessage *message)
+    {
+        // Dismissed at once, as if Back was pressed
+        UNUSED(context);
+        lastDialogHeader = message->header;
+        lastDialogText = message->text;
+        return DialogMessageButtonBack;
+    }
+
+    const char *host_last_dialog_header(void)
+    {
+        return lastDialogHeader.c_str();
+    }
+
+    const char *host_last_dialog_text(void)
+    {
+        return lastDialogText.c_str();
+    }
+}
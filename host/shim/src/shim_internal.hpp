@@ -0,0 +1,10 @@
+#pragma once
+
+// Pieces shared between the shim's translation units.
+
+#include <gui/gui.h>
+#include <storage/storage.h>
+
+Storage *host_storage_record();
+Gui *host_gui_record();
+void host_busy_us(uint32_t microseconds);
@@ -0,0 +1,434 @@
+// Storage on the host: "/ext/..." paths live under a temp directory and
+// files are stdio streams, optionally behind an SD card latency model.
+
+#include <storage/storage.h>
+
+#include "host_shim.h"
+#include "shim_internal.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct Storage
+{
+    std::string root;
+};
+
+struct File
+{
+    FILE *stream = nullptr;
+    uint32_t block = UINT32_MAX; // Block held in the file's buffer
+    bool dirty = false;          // Buffer holds writes the card has not seen
+    bool written = false;        // Written since it was opened
+};
+
+const HostStorageLatency host_storage_latency_flipper = {
+    .openUs = 3000,
+    .closeUs = 4000,
+    .seekUs = 50,
+    .readUs = 30,
+    .writeUs = 30,
+    .blockSize = 512,
+    .blockReadUs = 400,
+    .blockWriteUs = 1200,
+    .stallEvery = 64,
+    .stallUs = 25000,
+    .jitterPercent = 30,
+    .seed = 1,
+};
+
+namespace
+{
+    Storage storage;
+    HostStorageStats stats{};
+    bool latencyEnabled = false;
+    HostStorageLatency latency{};
+    uint32_t jitterState = 1;
+    std::string failPath;
+    uint32_t failOpens = 0;
+
+    void charge(uint32_t microseconds)
+    {
+        if (!latencyEnabled || microseconds == 0)
+        {
+            return;
+        }
+        if (latency.jitterPercent > 0)
+        {
+            jitterState ^= jitterState << 13;
+            jitterState ^= jitterState >> 17;
+            jitterState ^= jitterState << 5;
+            uint32_t spread = microseconds * latency.jitterPercent / 100;
+            microseconds = microseconds - spread + jitterState % (2 * spread + 1);
+        }
+        stats.busyUs += microseconds;
+        host_busy_us(microseconds);
+    }
+
+    void flush(File *file)
+    {
+        if (!latencyEnabled || !file->dirty)
+        {
+            return;
+        }
+        file->dirty = false;
+        ++stats.blocksWritten;
+        charge(latency.blockWriteUs);
+        if (latency.stallEvery > 0 && stats.blocksWritten % latency.stallEvery == 0)
+        {
+            charge(latency.stallUs);
+        }
+    }
+
+    // Moves the buffer over [offset, offset + size); writes that cover a
+    // whole block skip loading it first
+    void touch(File *file, uint64_t offset, size_t size, bool writing)
+    {
+        if (!latencyEnabled || size == 0)
+        {
+            return;
+        }
+        uint64_t blockSize = latency.blockSize > 0 ? latency.blockSize : 512;
+        uint64_t end = offset + size;
+        for (uint64_t block = offset / blockSize; block * blockSize < end; ++block)
+        {
+            if (block != file->block)
+            {
+                flush(file);
+                bool whole = writing && offset <= block * blockSize && end >= (block + 1) * blockSize;
+                if (!whole)
+                {
+                    ++stats.blocksRead;
+                    charge(latency.blockReadUs);
+                }
+                file->block = static_cast<uint32_t>(block);
+            }
+            file->dirty = file->dirty || writing;
+        }
+    }
+
+    // A real card always has /ext/apps_data; apps create their own folder in it
+    void prepare(const std::string &path)
+    {
+        mkdir(path.c_str(), 0755);
+        mkdir((path + "/apps_data").c_str(), 0755);
+    }
+
+    const std::string &root()
+    {
+        if (storage.root.empty())
+        {
+            char pattern[] = "/tmp/golf_score_host.XXXXXX";
+            const char *created = mkdtemp(pattern);
+            if (!created)
+            {
+                fprintf(stderr, "shim: mkdtemp failed: %s\n", strerror(errno));
+                abort();
+            }
+            storage.root = created;
+            prepare(storage.root);
+        }
+        return storage.root;
+    }
+
+    std::string host_path(const char *path)
+    {
+        size_t prefix = strlen(STORAGE_EXT_PATH_PREFIX);
+        if (strncmp(path, STORAGE_EXT_PATH_PREFIX, prefix) == 0 && (path[prefix] == '/' || path[prefix] == '\0'))
+        {
+            path += prefix;
+        }
+        return root() + path;
+    }
+
+    bool exists(const std::string &path)
+    {
+        struct stat info;
+        return stat(path.c_str(), &info) == 0;
+    }
+
+    FS_Error error_from_errno()
+    {
+        switch (errno)
+        {
+        case EEXIST:
+            return FSE_EXIST;
+        case ENOENT:
+            return FSE_NOT_EXIST;
+        case EACCES:
+        case EPERM:
+        case ENOTEMPTY:
+            return FSE_DENIED;
+        default:
+            return FSE_INTERNAL;
+        }
+    }
+
+    void remove_tree(const std::string &path, bool keep)
+    {
+        if (DIR *dir = opendir(path.c_str()))
+        {
+            while (struct dirent *entry = readdir(dir))
+            {
+                if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+                {
+                    remove_tree(path + "/" + entry->d_name, false);
+                }
+            }
+            closedir(dir);
+            if (!keep)
+            {
+                rmdir(path.c_str());
+            }
+        }
+        else if (!keep)
+        {
+            unlink(path.c_str());
+        }
+    }
+}
+
+Storage *host_storage_record()
+{
+    root();
+    return &storage;
+}
+
+extern "C"
+{
+    const char *host_storage_root(void)
+    {
+        return root().c_str();
+    }
+
+    void host_storage_set_root(const char *path)
+    {
+        storage.root = path;
+        prepare(storage.root);
+    }
+
+    void host_storage_wipe(void)
+    {
+        remove_tree(root(), true);
+        prepare(storage.root);
+    }
+
+    const HostStorageStats *host_storage_stats(void)
+    {
+        return &stats;
+    }
+
+    void host_storage_reset_stats(void)
+    {
+        stats = HostStorageStats{};
+    }
+
+    void host_storage_fail_opens(const char *path, uint32_t count)
+    {
+        failPath = path ? path : "";
+        failOpens = count;
+    }
+
+    void host_storage_set_latency(const HostStorageLatency *model)
+    {
+        latencyEnabled = model != nullptr;
+        latency = model ? *model : HostStorageLatency{};
+        jitterState = latency.seed ? latency.seed : 1;
+    }
+
+    File *storage_file_alloc(Storage *)
+    {
+        return new File();
+    }
+
+    void storage_file_free(File *file)
+    {
+        storage_file_close(file);
+        delete file;
+    }
+
+    bool storage_file_open(File *file, const char *path, FS_AccessMode access_mode, FS_OpenMode open_mode)
+    {
+        UNUSED(access_mode);
+        storage_file_close(file);
+        if (failOpens > 0 && failPath == path)
+        {
+            --failOpens;
+            return false;
+        }
+
+        // Every mode opens read/write; FatFs-style semantics come from the
+        // open mode alone
+        std::string target = host_path(path);
+        bool present = exists(target);
+        const char *mode = nullptr;
+        switch (open_mode)
+        {
+        case FSOM_OPEN_EXISTING:
+            mode = present ? "r+b" : nullptr;
+            break;
+        case FSOM_OPEN_ALWAYS:
+        case FSOM_OPEN_APPEND:
+            mode = present ? "r+b" : "w+b";
+            break;
+        case FSOM_CREATE_NEW:
+            mode = present ? nullptr : "w+b";
+            break;
+        case FSOM_CREATE_ALWAYS:
+            mode = "w+b";
+            break;
+        }
+        if (!mode)
+        {
+            return false;
+        }
+
+        ++stats.opens;
+        charge(latency.openUs);
+        file->stream = fopen(target.c_str(), mode);
+        file->block = UINT32_MAX;
+        file->dirty = false;
+        file->written = false;
+        if (file->stream && open_mode == FSOM_OPEN_APPEND)
+        {
+            fseek(file->stream, 0, SEEK_END);
+        }
+        return file->stream != nullptr;
+    }
+
+    bool storage_file_close(File *file)
+    {
+        if (!file->stream)
+        {
+            return false;
+        }
+        flush(file);
+        if (file->written)
+        {
+            charge(latency.closeUs);
+        }
+        fclose(file->stream);
+        file->stream = nullptr;
+        return true;
+    }
+
+    bool storage_file_is_open(File *file)
+    {
+        return file->stream != nullptr;
+    }
+
+    size_t storage_file_read(File *file, void *buff, size_t bytes_to_read)
+    {
+        if (!file->stream)
+        {
+            return 0;
+        }
+        // stdio needs a positioning call between a write and a read
+        fseek(file->stream, 0, SEEK_CUR);
+        uint64_t offset = static_cast<uint64_t>(ftell(file->stream));
+        size_t read = fread(buff, 1, bytes_to_read, file->stream);
+        ++stats.reads;
+        stats.bytesRead += read;
+        charge(latency.readUs);
+        touch(file, offset, read, false);
+        return read;
+    }
+
+    size_t storage_file_write(File *file, const void *buff, size_t bytes_to_write)
+    {
+        if (!file->stream)
+        {
+            return 0;
+        }
+        fseek(file->stream, 0, SEEK_CUR);
+        uint64_t offset = static_cast<uint64_t>(ftell(file->stream));
+        size_t written = fwrite(buff, 1, bytes_to_write, file->stream);
+        ++stats.writes;
+        stats.bytesWritten += written;
+        file->written = true;
+        charge(latency.writeUs);
+        touch(file, offset, written, true);
+        return written;
+    }
+
+    bool storage_file_seek(File *file, uint32_t offset, bool from_start)
+    {
+        ++stats.seeks;
+        charge(latency.seekUs);
+        return file->stream && fseek(file->stream, static_cast<long>(offset), from_start ? SEEK_SET : SEEK_CUR) == 0;
+    }
+
+    uint64_t storage_file_tell(File *file)
+    {
+        return file->stream ? static_cast<uint64_t>(ftell(file->stream)) : 0;
+    }
+
+    bool storage_file_truncate(File *file)
+    {
+        if (!file->stream)
+        {
+            return false;
+        }
+        flush(file);
+        file->written = true;
+        fflush(file->stream);
+        return ftruncate(fileno(file->stream), ftell(file->stream)) == 0;
+    }
+
+    uint64_t storage_file_size(File *file)
+    {
+        if (!file->stream)
+        {
+            return 0;
+        }
+        fflush(file->stream);
+        struct stat info;
+        return fstat(fileno(file->stream), &info) == 0 ? static_cast<uint64_t>(info.st_size) : 0;
+    }
+
+    bool storage_file_sync(File *file)
+    {
+        if (!file->stream)
+        {
+            return false;
+        }
+        flush(file);
+        return fflush(file->stream) == 0;
+    }
+
+    bool storage_file_eof(File *file)
+    {
+        return !file->stream || storage_file_tell(file) >= storage_file_size(file);
+    }
+
+    bool storage_file_exists(Storage *, const char *path)
+    {
+        struct stat info;
+        return stat(host_path(path).c_str(), &info) == 0 && S_ISREG(info.st_mode);
+    }
+
+    FS_Error storage_common_mkdir(Storage *, const char *path)
+    {
+        charge(latency.openUs);
+        return mkdir(host_path(path).c_str(), 0755) == 0 ? FSE_OK : error_from_errno();
+    }
+
+    FS_Error storage_common_remove(Storage *, const char *path)
+    {
+        charge(latency.openUs);
+        return remove(host_path(path).c_str()) == 0 ? FSE_OK : error_from_errno();
+    }
+
+    FS_Error storage_common_rename(Storage *, const char *old_path, const char *new_path)
+    {
+        charge(latency.openUs);
+        return rename(host_path(old_path).c_str(), host_path(new_path).c_str()) == 0 ? FSE_OK : error_from_errno();
+    }
+}
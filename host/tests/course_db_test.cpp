@@ -0,0 +1,304 @@
+// Course library: the blocked name index against a sorted model through
+// adds, renames, growth and deletes up to the library limit, the cost of
+// one save on a full library, and rebuilding the index after an update was
+// cut short or from the flat index of earlier versions.
+
+#include "app.hpp"
+#include "courses/course_db.hpp"
+#include "host_shim.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define CHECK(expr)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(expr))                                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            exit(1);                                                       \
+        }                                                                  \
+    } while (0)
+
+namespace
+{
+    struct Model
+    {
+        std::string name;
+        uint16_t id;
+        uint8_t holeCount;
+    };
+
+    std::vector<Model> model;
+    uint32_t seed = 12345;
+
+    uint32_t next()
+    {
+        seed = seed * 1664525 + 1013904223;
+        return seed >> 8;
+    }
+
+    std::string lower(std::string text)
+    {
+        for (char &ch : text)
+        {
+            ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+        }
+        return text;
+    }
+
+    void sortModel()
+    {
+        std::sort(model.begin(), model.end(), [](const Model &a, const Model &b)
+                  {
+                      std::string la = lower(a.name);
+                      std::string lb = lower(b.name);
+                      return la != lb ? la < lb : a.id < b.id; });
+    }
+
+    // Few distinct names, so equal names and shared prefixes are common
+    std::string randomName()
+    {
+        static const char *const Stems[] = {"Alder", "alder", "Birch", "Cedar", "Dune", "Elm"};
+        char name[GolfScoreCourseNameLength];
+        snprintf(name, sizeof(name), "%s %u", Stems[next() % 6], static_cast<unsigned>(next() % 40));
+        return name;
+    }
+
+    uint16_t save(GolfScoreCourseDb &db, uint16_t id, const std::string &name, uint8_t holeCount, bool ranked)
+    {
+        GolfScoreCourse course;
+        course.id = id;
+        course.holeCount = holeCount;
+        for (uint8_t hole = 0; hole < holeCount; ++hole)
+        {
+            course.par[hole] = static_cast<uint8_t>(3 + hole % 3);
+            course.strokeIndex[hole] = ranked ? static_cast<uint8_t>(hole + 1) : 0;
+        }
+        snprintf(course.name.data(), course.name.size(), "%s", name.c_str());
+        return db.save(course);
+    }
+
+    void checkMatches(GolfScoreCourseDb &db)
+    {
+        sortModel();
+        CHECK(db.count() == model.size());
+        std::vector<GolfScoreCourseEntry> entries(model.size() + 1);
+        CHECK(db.readEntries(0, entries.data(), entries.size()) == model.size());
+        for (size_t i = 0; i < model.size(); ++i)
+        {
+            CHECK(entries[i].id == model[i].id);
+            CHECK(model[i].name == entries[i].name.data());
+            CHECK(entries[i].holeCount == model[i].holeCount);
+        }
+
+        // Windows that start inside a block and span several
+        GolfScoreCourseEntry window[40];
+        for (uint32_t first = 0; first < model.size(); first += 37)
+        {
+            size_t count = db.readEntries(first, window, 40);
+            CHECK(count == std::min<size_t>(40, model.size() - first));
+            for (size_t i = 0; i < count; ++i)
+            {
+                CHECK(window[i].id == model[first + i].id);
+            }
+        }
+
+        if (!model.empty())
+        {
+            const Model &probe = model[next() % model.size()];
+            GolfScoreCourseEntry found;
+            CHECK(db.findByName(probe.name.c_str(), found) && lower(found.name.data()) == lower(probe.name));
+
+            uint32_t first = 0;
+            uint32_t end = UINT32_MAX;
+            CHECK(db.narrowByPrefix("bir", first, end));
+            size_t expected = std::count_if(model.begin(), model.end(), [](const Model &course)
+                                            { return lower(course.name).rfind("bir", 0) == 0; });
+            CHECK(end - first == expected);
+        }
+    }
+
+    std::string dataPath(const char *name)
+    {
+        char path[256];
+        GolfScoreCourseDb::path(path, sizeof(path), name);
+        return path;
+    }
+
+    std::string readFile(const char *name)
+    {
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        std::string data;
+        if (storage_file_open(file, dataPath(name).c_str(), FSAM_READ, FSOM_OPEN_EXISTING))
+        {
+            char buffer[512];
+            size_t count;
+            while ((count = storage_file_read(file, buffer, sizeof(buffer))) > 0)
+            {
+                data.append(buffer, count);
+            }
+        }
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+        return data;
+    }
+
+    void writeFile(const char *name, const std::string &data)
+    {
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        CHECK(storage_file_open(file, dataPath(name).c_str(), FSAM_WRITE, FSOM_CREATE_ALWAYS));
+        CHECK(data.empty() || storage_file_write(file, data.data(), data.size()) == data.size());
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+    }
+
+    // Header: magic, version, freeHead, liveCount, flags, end; records start
+    // with inUse, holeCount, capacity, flags, nextFree
+    constexpr size_t DbFreeHeadOffset = 6;
+    constexpr size_t DbFlagsOffset = 10;
+    constexpr size_t DbEndOffset = 12;
+    constexpr uint32_t DbHeaderBytes = 16;
+    constexpr uint32_t DbRecordBytes = 24;
+}
+
+int main()
+{
+    host_log_set_level(FuriLogLevelNone);
+    host_storage_wipe();
+    GolfScoreApp app; // Creates the data directory
+    GolfScoreCourseDb db;
+    checkMatches(db);
+
+    // Fill the library with adds, renames and courses that outgrow their
+    // record, deleting now and then
+    while (model.size() < GolfScoreMaxCourses)
+    {
+        uint32_t choice = next() % 10;
+        if (choice < 7 || model.empty())
+        {
+            std::string name = randomName();
+            uint8_t holeCount = static_cast<uint8_t>(9 * (1 + next() % 2));
+            uint16_t id = save(db, GolfScoreCourseDb::InvalidId, name, holeCount, false);
+            CHECK(id != GolfScoreCourseDb::InvalidId);
+            model.push_back({name, id, holeCount});
+        }
+        else if (choice < 9)
+        {
+            Model &course = model[next() % model.size()];
+            course.name = randomName();
+            if (choice == 8)
+            {
+                course.holeCount = 36;
+            }
+            uint16_t id = save(db, course.id, course.name, course.holeCount, choice == 8);
+            CHECK(id != GolfScoreCourseDb::InvalidId);
+            course.id = id;
+        }
+        else
+        {
+            size_t victim = next() % model.size();
+            CHECK(db.remove(model[victim].id));
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(victim));
+        }
+        if (next() % 50 == 0)
+        {
+            checkMatches(db);
+        }
+    }
+    checkMatches(db);
+    CHECK(save(db, GolfScoreCourseDb::InvalidId, "One too many", 18, false) == GolfScoreCourseDb::InvalidId);
+
+    // On a full library one save touches a bounded part of the index: the
+    // search, one block of entries and the directory, never the whole file
+    uint32_t indexBytes = static_cast<uint32_t>(readFile("courses.idx").size());
+    host_storage_reset_stats();
+    CHECK(save(db, model[0].id, "Zz last", model[0].holeCount, false) != GolfScoreCourseDb::InvalidId);
+    model[0].name = "Zz last";
+    const HostStorageStats *stats = host_storage_stats();
+    CHECK(stats->bytesWritten < 2048 && stats->bytesWritten < indexBytes / 10);
+    checkMatches(db);
+
+    // Delete most of the library; merged blocks keep the directory small
+    while (model.size() > 20)
+    {
+        size_t victim = next() % model.size();
+        CHECK(db.remove(model[victim].id));
+        model.erase(model.begin() + static_cast<std::ptrdiff_t>(victim));
+        if (next() % 50 == 0)
+        {
+            checkMatches(db);
+        }
+    }
+    checkMatches(db);
+
+    // A free list that loops on a slot too small for the save: the walk
+    // stops, relinks the free records and appends; the relinked list then
+    // serves the next small save
+    {
+        std::string file = readFile("courses.db");
+        uint32_t end;
+        memcpy(&end, file.data() + DbEndOffset, sizeof(end));
+        uint32_t offset = DbHeaderBytes;
+        uint16_t small = GolfScoreCourseDb::InvalidId;
+        while (offset + DbRecordBytes <= end)
+        {
+            uint8_t capacity = static_cast<uint8_t>(file[offset + 2]);
+            if (file[offset] == 0 && capacity < 72)
+            {
+                small = static_cast<uint16_t>(offset / 4);
+            }
+            offset += DbRecordBytes + capacity;
+        }
+        CHECK(small != GolfScoreCourseDb::InvalidId);
+        memcpy(&file[DbFreeHeadOffset], &small, sizeof(small));
+        memcpy(&file[small * 4 + 4], &small, sizeof(small));
+        writeFile("courses.db", file);
+
+        uint16_t id = save(db, GolfScoreCourseDb::InvalidId, "Loop grown", 36, true);
+        CHECK(id != GolfScoreCourseDb::InvalidId && id * 4u >= end);
+        model.push_back({"Loop grown", id, 36});
+        id = save(db, GolfScoreCourseDb::InvalidId, "Loop small", 9, false);
+        CHECK(id != GolfScoreCourseDb::InvalidId && id * 4u < end);
+        model.push_back({"Loop small", id, 9});
+        checkMatches(db);
+    }
+
+    // An update cut short leaves the header flagged; the next open, even
+    // one that only reads, rebuilds the index from the records
+    std::string records = readFile("courses.db");
+    std::string flagged = records;
+    flagged[DbFlagsOffset] = 1;
+    writeFile("courses.db", flagged);
+    writeFile("courses.idx", readFile("courses.idx").substr(0, 300));
+    checkMatches(db);
+    CHECK(readFile("courses.db") == records);
+
+    // An index that disagrees with the live count is rebuilt too
+    writeFile("courses.idx", std::string());
+    checkMatches(db);
+
+    // Earlier versions kept a flat sorted array of entries
+    std::string flat;
+    for (const Model &course : model)
+    {
+        GolfScoreCourseEntry entry;
+        snprintf(entry.name.data(), entry.name.size(), "%s", course.name.c_str());
+        entry.id = course.id;
+        entry.holeCount = course.holeCount;
+        flat.append(reinterpret_cast<const char *>(&entry), sizeof(entry));
+    }
+    writeFile("courses.idx", flat);
+    checkMatches(db);
+
+    host_storage_wipe();
+    puts("host course db test passed");
+    return 0;
+}
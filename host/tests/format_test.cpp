@@ -0,0 +1,327 @@
+// Byte-exact golden files for everything the app keeps on the SD card.
+//
+//   host_format_test <golden dir> [--update]
+//
+// Pinned outputs: state.bin as the app saves it (version 9), state.journal
+// after edits, undo and redo, the snapshot a restart folds the journal into,
+// rounds.csv with individual and team rows, and the course library
+// (courses.db, courses.idx). Every older state version in <golden dir>/legacy
+// is loaded and re-saved, and must come out as its *.migrated.bin golden, and
+// a round appended to the 18-hole rounds.csv of earlier versions must widen it
+// to legacy/rounds_h18.widened.csv.
+//
+// A failure means a save or export would write different bytes than the
+// released app: a struct layout or CSV column changed. If that is intended,
+// bump the state version with a migration (or the CSV/course format), then
+// rerun with --update and review the diff. --update never touches the legacy
+// inputs; they are what older releases wrote.
+
+#include "app.hpp"
+#include "common/host_access.hpp"
+#include "host_shim.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define CHECK(expr)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(expr))                                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            exit(1);                                                       \
+        }                                                                  \
+    } while (0)
+
+namespace
+{
+    const char *goldenDir = nullptr;
+    bool update = false;
+    bool failed = false;
+
+    const char *const LegacyStates[] = {
+        "state_v1", "state_v1_version0", "state_v2", "state_v3", "state_v4", "state_v5", "state_v6", "state_v7", "state_v8",
+    };
+
+    std::string readHostFile(const std::string &path)
+    {
+        std::string data;
+        FILE *file = fopen(path.c_str(), "rb");
+        if (!file)
+        {
+            return data;
+        }
+        char buffer[4096];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            data.append(buffer, count);
+        }
+        fclose(file);
+        return data;
+    }
+
+    bool writeHostFile(const std::string &path, const std::string &data)
+    {
+        FILE *file = fopen(path.c_str(), "wb");
+        if (!file)
+        {
+            return false;
+        }
+        bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+        return fclose(file) == 0 && written;
+    }
+
+    std::string dataPath(const char *name)
+    {
+        char path[256];
+        snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, name);
+        return path;
+    }
+
+    std::string readAppFile(const char *name)
+    {
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        std::string data;
+        if (storage_file_open(file, dataPath(name).c_str(), FSAM_READ, FSOM_OPEN_EXISTING))
+        {
+            char buffer[512];
+            size_t count;
+            while ((count = storage_file_read(file, buffer, sizeof(buffer))) > 0)
+            {
+                data.append(buffer, count);
+            }
+        }
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+        return data;
+    }
+
+    void writeAppFile(const char *name, const std::string &data)
+    {
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        CHECK(storage_file_open(file, dataPath(name).c_str(), FSAM_WRITE, FSOM_CREATE_ALWAYS));
+        CHECK(storage_file_write(file, data.data(), data.size()) == data.size());
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+    }
+
+    // Where the two differ first, so a layout shift is easy to place
+    void reportDifference(const char *golden, const std::string &expected, const std::string &actual)
+    {
+        size_t at = 0;
+        while (at < expected.size() && at < actual.size() && expected[at] == actual[at])
+        {
+            ++at;
+        }
+        fprintf(stderr, "%s: %zu bytes written, golden has %zu; first difference at offset %zu\n", golden, actual.size(), expected.size(), at);
+    }
+
+    void check(const std::string &golden, const std::string &actual)
+    {
+        std::string path = std::string(goldenDir) + "/" + golden;
+        if (update)
+        {
+            if (!writeHostFile(path, actual))
+            {
+                fprintf(stderr, "%s: could not write\n", path.c_str());
+                failed = true;
+            }
+            return;
+        }
+
+        std::string expected = readHostFile(path);
+        if (expected.empty() && !actual.empty())
+        {
+            fprintf(stderr, "%s: missing golden\n", path.c_str());
+            failed = true;
+        }
+        else if (expected != actual)
+        {
+            reportDifference(golden.c_str(), expected, actual);
+            failed = true;
+        }
+    }
+
+    void nextHour()
+    {
+        DateTime now;
+        furi_hal_rtc_get_datetime(&now);
+        ++now.hour;
+        furi_hal_rtc_set_datetime(&now);
+    }
+
+    // Four players over 18 holes with names, handicaps, stroke indices, hole
+    // details, a course, Stableford and best-ball teams: every field the
+    // current format stores is away from its default
+    void checkCurrentFormats()
+    {
+        host_storage_wipe();
+        {
+            GolfScoreApp app;
+            GolfScoreHostAccess::loadState(app);
+            app.setHoleCount(18);
+            app.setPlayerCount(4);
+            app.setPlayerName(0, "Ann");
+            app.setPlayerName(1, "Bob");
+            app.setPlayerName(2, "Cy");
+            app.setPar(2, 3);
+            app.setPar(17, 5);
+            app.setStrokeIndex(0, 18);
+            app.setHandicap(1, 12);
+            app.setHandicap(2, -2);
+            CHECK(app.saveCourse(GolfScoreApp::InvalidCourseId, "Golden Links") != GolfScoreApp::InvalidCourseId);
+            CHECK(app.saveCourse(GolfScoreApp::InvalidCourseId, "Alder Creek") != GolfScoreApp::InvalidCourseId);
+            app.setFormat(GolfScoreFormatStableford);
+            app.setTeamMode(GolfScoreTeamsBestBall);
+            app.setTeam(0, 0);
+            app.setTeam(1, 1);
+            app.setTeam(2, 0);
+            app.setTeam(3, 1);
+            check("courses.db", readAppFile("courses.db"));
+            check("courses.idx", readAppFile("courses.idx"));
+
+            // Hole edits go to the journal; the snapshot below also holds them
+            for (uint8_t player = 0; player < 4; ++player)
+            {
+                for (uint8_t hole = 0; hole < 18; ++hole)
+                {
+                    app.adjustScore(player, hole, static_cast<int8_t>(app.getPar(hole) + (player + hole) % 3 - 1));
+                }
+            }
+            app.adjustStat(0, 0, GolfScoreStatPutts, 2);
+            app.adjustStat(0, 1, GolfScoreStatFairway, 1);
+            app.adjustStat(0, 2, GolfScoreStatGreen, 1);
+            app.adjustStat(1, 3, GolfScoreStatPenalties, 2);
+            CHECK(GolfScoreHostAccess::writeState(app));
+            check("state_v9.bin", readAppFile("state.bin"));
+
+            std::string journalBefore = readAppFile("state.journal");
+            app.adjustScore(3, 17, 2);
+            app.adjustStat(2, 5, GolfScoreStatFairway, 2);
+            uint8_t player;
+            uint8_t hole;
+            CHECK(app.undoEdit(player, hole));
+            CHECK(app.undoEdit(player, hole));
+            CHECK(app.redoEdit(player, hole));
+            CHECK(readAppFile("state.journal") != journalBefore);
+            check("state.journal", readAppFile("state.journal"));
+
+            nextHour();
+            CHECK(app.exportRoundHistory());
+            nextHour();
+            app.setTeamMode(GolfScoreTeamsAggregate);
+            CHECK(app.exportRoundHistory());
+            check("rounds.csv", readAppFile("rounds.csv"));
+        }
+
+        // A restart loads the last save and replays its journal
+        {
+            GolfScoreApp app;
+            GolfScoreHostAccess::loadState(app);
+            CHECK(GolfScoreHostAccess::writeState(app));
+            check("state_v9_replayed.bin", readAppFile("state.bin"));
+        }
+    }
+
+    void checkRoundTrip(const char *golden)
+    {
+        std::string input = readHostFile(std::string(goldenDir) + "/" + golden);
+        CHECK(!input.empty());
+        host_storage_wipe();
+        GolfScoreApp app; // Creates the data directory; the state loads below
+        writeAppFile("state.bin", input);
+        GolfScoreHostAccess::loadState(app);
+        CHECK(GolfScoreHostAccess::writeState(app));
+        if (readAppFile("state.bin") != input)
+        {
+            reportDifference(golden, input, readAppFile("state.bin"));
+            fprintf(stderr, "%s: loading and saving a current file changed it\n", golden);
+            failed = true;
+        }
+    }
+
+    // A 9-hole round on top of a log whose header stops at H18
+    void checkLegacyHistory()
+    {
+        std::string input = readHostFile(std::string(goldenDir) + "/legacy/rounds_h18.csv");
+        CHECK(!input.empty());
+        host_storage_wipe();
+        GolfScoreApp app;
+        GolfScoreHostAccess::loadState(app);
+        writeAppFile("rounds.csv", input);
+        app.setHoleCount(9);
+        app.setPlayerCount(2);
+        app.setPlayerName(0, "Ann");
+        app.setPlayerName(1, "Bob");
+        for (uint8_t hole = 0; hole < 9; ++hole)
+        {
+            app.adjustScore(0, hole, static_cast<int8_t>(app.getPar(hole) + hole % 2));
+            app.adjustScore(1, hole, static_cast<int8_t>(app.getPar(hole)));
+        }
+        CHECK(app.exportRoundHistory());
+        check("legacy/rounds_h18.widened.csv", readAppFile("rounds.csv"));
+    }
+
+    void checkLegacy(const char *name)
+    {
+        std::string input = readHostFile(std::string(goldenDir) + "/legacy/" + name + ".bin");
+        CHECK(!input.empty());
+        host_storage_wipe();
+        GolfScoreApp app; // Creates the data directory; the state loads below
+        writeAppFile("state.bin", input);
+        GolfScoreHostAccess::loadState(app);
+        CHECK(GolfScoreHostAccess::writeState(app));
+        check(std::string("legacy/") + name + ".migrated.bin", readAppFile("state.bin"));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--update") == 0)
+        {
+            update = true;
+        }
+        else if (!goldenDir && argv[i][0] != '-')
+        {
+            goldenDir = argv[i];
+        }
+        else
+        {
+            goldenDir = nullptr;
+            break;
+        }
+    }
+    if (!goldenDir)
+    {
+        fprintf(stderr, "usage: %s <golden dir> [--update]\n", argv[0]);
+        return 2;
+    }
+
+    host_log_set_level(FuriLogLevelNone);
+    checkCurrentFormats();
+    if (!update)
+    {
+        checkRoundTrip("state_v9.bin");
+        checkRoundTrip("state_v9_replayed.bin");
+    }
+    for (const char *name : LegacyStates)
+    {
+        checkLegacy(name);
+    }
+    checkLegacyHistory();
+    host_storage_wipe();
+
+    if (failed)
+    {
+        return 1;
+    }
+    fprintf(stderr, update ? "goldens updated\n" : "on-disk formats match their goldens\n");
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Latency histograms: bucketing, accumulation across app sessions through
+// latency.bin, the CSV export and what happens to unreadable files.
+
+#include "app.hpp"
+#include "debug/latency.hpp"
+#include "history/history.hpp"
+#include "host_shim.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define CHECK(expr)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(expr))                                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            exit(1);                                                       \
+        }                                                                  \
+    } while (0)
+
+namespace
+{
+    void dataPath(char *path, size_t size, const char *name)
+    {
+        snprintf(path, size, STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/%s", APP_ID, name);
+    }
+
+    std::string readFile(const char *name)
+    {
+        char path[256];
+        dataPath(path, sizeof(path), name);
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        std::string data;
+        if (storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING))
+        {
+            char buffer[256];
+            size_t count;
+            while ((count = storage_file_read(file, buffer, sizeof(buffer))) > 0)
+            {
+                data.append(buffer, count);
+            }
+        }
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+        return data;
+    }
+
+    void writeFile(const char *name, const std::string &data)
+    {
+        char path[256];
+        dataPath(path, sizeof(path), name);
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        CHECK(storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+        CHECK(storage_file_write(file, data.data(), data.size()) == data.size());
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+    }
+
+    uint32_t samples(GolfScoreLatencyOp op)
+    {
+        uint32_t total = 0;
+        for (uint32_t count : golf_score_latency(op).counts)
+        {
+            total += count;
+        }
+        return total;
+    }
+}
+
+int main()
+{
+    host_log_set_level(FuriLogLevelNone);
+    host_storage_wipe();
+
+    CHECK(golf_score_latency_bucket(0) == 0);
+    CHECK(golf_score_latency_bucket(1) == 1);
+    CHECK(golf_score_latency_bucket(2) == 2);
+    CHECK(golf_score_latency_bucket(3) == 2);
+    CHECK(golf_score_latency_bucket(1023) == 10);
+    CHECK(golf_score_latency_bucket(1024) == 11);
+    CHECK(golf_score_latency_bucket(1u << 22) == GolfScoreLatencyBuckets - 1);
+    CHECK(golf_score_latency_bucket(UINT32_MAX) == GolfScoreLatencyBuckets - 1);
+
+    // A session with a save, an export and a history view
+    {
+        GolfScoreApp app;
+        app.runDispatcher();
+        app.setPlayerCount(2);
+        CHECK(app.exportRoundHistory());
+        GolfScoreRoundLog log;
+        GolfScoreHistoryRecord record;
+        CHECK(log.open() && log.fetch(0, record));
+        CHECK(log.fetch(0, record)); // Cached: not a read
+    }
+    CHECK(samples(GolfScoreLatencySave) >= 1);
+    CHECK(samples(GolfScoreLatencyHistoryAppend) == 1);
+    CHECK(samples(GolfScoreLatencyHistoryOpen) == 1);
+    CHECK(samples(GolfScoreLatencyHistoryRead) == 1);
+    uint32_t saves = samples(GolfScoreLatencySave);
+    std::string saved = readFile("latency.bin");
+    CHECK(saved.size() == 8 + GolfScoreLatencyOpCount * sizeof(GolfScoreLatencyHistogram));
+
+    // The next session adds to what the last one left
+    {
+        GolfScoreApp app;
+        app.runDispatcher();
+        CHECK(samples(GolfScoreLatencyHistoryAppend) == 1);
+        CHECK(app.exportRoundHistory());
+        CHECK(golf_score_latency_export_csv());
+    }
+    CHECK(samples(GolfScoreLatencyHistoryAppend) == 2);
+    CHECK(samples(GolfScoreLatencySave) == saves);
+
+    std::string csv = readFile("latency.csv");
+    CHECK(csv.rfind("op,samples,max_us,0,1,2,4,", 0) == 0);
+    CHECK(csv.find(",4194304\n") != std::string::npos);
+    CHECK(csv.find("\nhistory_append,2,") != std::string::npos);
+    CHECK(csv.find("\nhistory_open,1,") != std::string::npos);
+    size_t lines = 0;
+    for (char ch : csv)
+    {
+        lines += ch == '\n';
+    }
+    CHECK(lines == 1 + GolfScoreLatencyOpCount);
+    for (size_t at = csv.find('\n'); at + 1 < csv.size(); at = csv.find('\n', at + 1))
+    {
+        size_t end = csv.find('\n', at + 1);
+        size_t commas = 0;
+        for (size_t i = at + 1; i < end; ++i)
+        {
+            commas += csv[i] == ',';
+        }
+        CHECK(commas == 2 + GolfScoreLatencyBuckets);
+    }
+
+    // A file from a build with fewer operations loads what it has
+    std::string older = readFile("latency.bin");
+    older[5] = 1;
+    older.resize(8 + sizeof(GolfScoreLatencyHistogram));
+    writeFile("latency.bin", older);
+    CHECK(golf_score_latency_load());
+    CHECK(samples(GolfScoreLatencySave) == saves);
+    CHECK(samples(GolfScoreLatencyHistoryAppend) == 0);
+
+    // Damaged files are ignored, and a session without samples leaves them be
+    writeFile("latency.bin", "GSLH");
+    CHECK(!golf_score_latency_load());
+    CHECK(samples(GolfScoreLatencySave) == 0);
+    CHECK(golf_score_latency_save());
+    CHECK(readFile("latency.bin") == "GSLH");
+
+    host_storage_wipe();
+    puts("host latency test passed");
+    return 0;
+}
@@ -0,0 +1,182 @@
+// Renders the splash, the scorecard and the player name input, compares each
+// frame with its golden PBM and prints what drawing it costs.
+//
+//   host_render_test <golden dir> [--update]
+//
+// stdout gets one CSV row per frame:
+//
+//   frame,ns_per_frame,ops,strings,glyphs,text_bytes,boxes,frames,lines,dots,bitmaps,font_sets,font_switches,width_queries,pixels
+//
+// The goldens are the shim's rasterization (u8g2 glyphs and primitives, with
+// the firmware's built-in fonts stood in for by the app's embedded ones), so
+// they pin what the app draws, not the device's exact pixels. --update
+// rewrites them after an intended change; review the diff like any other.
+
+#include "app.hpp"
+#include "host_shim.h"
+#include "settings/settings.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t Iterations = 200;
+
+    const char *goldenDir = nullptr;
+    bool update = false;
+    bool failed = false;
+
+    void report(const char *name)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < Iterations; ++i)
+        {
+            host_render();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const HostCanvasStats &stats = *host_canvas_stats(host_render());
+        printf("%s,%.0f,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+               name,
+               std::chrono::duration<double, std::nano>(elapsed).count() / Iterations,
+               static_cast<unsigned>(stats.ops),
+               static_cast<unsigned>(stats.strings),
+               static_cast<unsigned>(stats.glyphs),
+               static_cast<unsigned>(stats.textBytes),
+               static_cast<unsigned>(stats.boxes),
+               static_cast<unsigned>(stats.frames),
+               static_cast<unsigned>(stats.lines),
+               static_cast<unsigned>(stats.dots),
+               static_cast<unsigned>(stats.bitmaps),
+               static_cast<unsigned>(stats.fontSets),
+               static_cast<unsigned>(stats.fontSwitches),
+               static_cast<unsigned>(stats.widthQueries),
+               static_cast<unsigned>(stats.pixels));
+        fflush(stdout);
+    }
+
+    std::vector<char> readFile(const char *path)
+    {
+        std::vector<char> data;
+        FILE *file = fopen(path, "rb");
+        if (!file)
+        {
+            return data;
+        }
+        char buffer[4096];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            data.insert(data.end(), buffer, buffer + count);
+        }
+        fclose(file);
+        return data;
+    }
+
+    void check(const char *name)
+    {
+        Canvas *canvas = host_render();
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s.pbm", goldenDir, name);
+        if (update)
+        {
+            if (!host_canvas_write_pbm(canvas, path))
+            {
+                fprintf(stderr, "%s: could not write\n", path);
+                failed = true;
+            }
+            report(name);
+            return;
+        }
+
+        std::vector<char> actual(HOST_CANVAS_PBM_SIZE);
+        actual.resize(host_canvas_pbm(canvas, actual.data(), actual.size()));
+        std::vector<char> golden = readFile(path);
+        if (golden != actual)
+        {
+            char fresh[512];
+            snprintf(fresh, sizeof(fresh), "%s.pbm", name);
+            host_canvas_write_pbm(canvas, fresh);
+            fprintf(stderr, "%s: frame differs from %s (written to ./%s)\n", name, path, fresh);
+            failed = true;
+        }
+        report(name);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--update") == 0)
+        {
+            update = true;
+        }
+        else if (!goldenDir && argv[i][0] != '-')
+        {
+            goldenDir = argv[i];
+        }
+        else
+        {
+            goldenDir = nullptr;
+            break;
+        }
+    }
+    if (!goldenDir)
+    {
+        fprintf(stderr, "usage: %s <golden dir> [--update]\n", argv[0]);
+        return 2;
+    }
+
+    host_log_set_level(FuriLogLevelError);
+    host_storage_wipe();
+
+    printf("frame,ns_per_frame,ops,strings,glyphs,text_bytes,boxes,frames,lines,dots,bitmaps,font_sets,font_switches,width_queries,pixels\n");
+    {
+        // The splash is up until the dispatcher handles the state load
+        GolfScoreApp app;
+        check("splash");
+        app.runDispatcher();
+
+        // Two players part way through the front nine
+        app.setPlayerCount(2);
+        for (uint8_t hole = 0; hole < 4; ++hole)
+        {
+            app.adjustScore(0, hole, static_cast<int8_t>(app.getPar(hole)));
+            app.adjustScore(1, hole, static_cast<int8_t>(app.getPar(hole) + hole % 2));
+        }
+        host_press(InputKeyOk);
+        host_press(InputKeyRight);
+        host_press(InputKeyUp);
+        check("scorecard");
+
+        host_press(InputKeyBack);
+        host_advance_ms(200);
+
+        // Settings, then OK on "Edit Name" for player 1
+        host_press(InputKeyDown);
+        host_press(InputKeyOk);
+        for (int i = 0; i < SettingsViewPlayerName; ++i)
+        {
+            host_press(InputKeyDown);
+        }
+        host_press(InputKeyOk);
+        if (host_current_view() != GolfScoreViewTextInput)
+        {
+            fprintf(stderr, "text input did not open\n");
+            return 1;
+        }
+        check("text_input");
+    }
+    host_storage_wipe();
+
+    if (failed)
+    {
+        return 1;
+    }
+    fprintf(stderr, update ? "goldens updated\n" : "frames match their goldens\n");
+    return 0;
+}
@@ -0,0 +1,254 @@
+// Drives the app through the shim: menu, scorecard, undo and a restart,
+// plus the Out/In split and handicap shares for each round size.
+
+#include "app.hpp"
+#include "common/host_access.hpp"
+#include "host_shim.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+#define CHECK(expr)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(expr))                                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            exit(1);                                                       \
+        }                                                                  \
+    } while (0)
+
+int main()
+{
+    host_storage_wipe();
+
+    {
+        GolfScoreApp app;
+        app.runDispatcher();
+        CHECK(host_current_view() == GolfScoreViewSubmenu);
+        CHECK(host_storage_root()[0] == '/');
+
+        // Scorecard: four strokes for player 1 on hole 1, then undo one
+        host_press(InputKeyOk);
+        for (int i = 0; i < 4; ++i)
+        {
+            host_press(InputKeyUp);
+        }
+        CHECK(app.getScore(0, 0) == 4);
+        CHECK(host_canvas_has_text(host_render(), "Hole 1/"));
+
+        // Holding Left/Right on the strokes page scrolls holes and edits nothing
+        host_send_input(InputKeyRight, InputTypePress);
+        host_send_input(InputKeyRight, InputTypeLong);
+        host_send_input(InputKeyRight, InputTypeRepeat);
+        host_send_input(InputKeyRight, InputTypeRepeat);
+        host_send_input(InputKeyRight, InputTypeRelease);
+        CHECK(host_canvas_has_text(host_render(), "Hole 3/"));
+        host_send_input(InputKeyLeft, InputTypePress);
+        host_send_input(InputKeyLeft, InputTypeLong);
+        host_send_input(InputKeyLeft, InputTypeRepeat);
+        host_send_input(InputKeyLeft, InputTypeRepeat);
+        host_send_input(InputKeyLeft, InputTypeRelease);
+        CHECK(host_canvas_has_text(host_render(), "Hole 1/"));
+        CHECK(app.getScore(0, 0) == 4);
+
+        // On the hole details page the same holds undo and redo, and their
+        // repeats do not change the highlighted stat
+        host_long_press(InputKeyBack);
+        host_send_input(InputKeyLeft, InputTypePress);
+        host_send_input(InputKeyLeft, InputTypeLong);
+        host_send_input(InputKeyLeft, InputTypeRepeat);
+        host_send_input(InputKeyLeft, InputTypeRelease);
+        CHECK(app.getScore(0, 0) == 3);
+        CHECK(app.getHoleEntry(0, 0).putts == 0);
+        host_long_press(InputKeyRight);
+        host_long_press(InputKeyLeft);
+        CHECK(app.getScore(0, 0) == 3);
+        host_press(InputKeyBack);
+
+        // Holding OK on the stats page shows the performance HUD; the
+        // hold's repeats do not move to the next player
+        host_long_press(InputKeyBack);
+        host_send_input(InputKeyOk, InputTypePress);
+        host_send_input(InputKeyOk, InputTypeLong);
+        host_send_input(InputKeyOk, InputTypeRepeat);
+        host_send_input(InputKeyOk, InputTypeRelease);
+        Canvas *hud = host_render();
+        CHECK(host_canvas_has_text(hud, " sd") && host_canvas_has_text(hud, "Player 1"));
+        host_long_press(InputKeyOk);
+        CHECK(!host_canvas_has_text(host_render(), " sd"));
+        host_press(InputKeyBack);
+
+        // Back leaves the scorecard once the refresh timer notices
+        host_press(InputKeyBack);
+        host_advance_ms(200);
+        CHECK(host_current_view() == GolfScoreViewSubmenu);
+        CHECK(host_canvas_has_text(host_render(), "Scorecard"));
+
+        host_press(InputKeyDown);
+        host_press(InputKeyOk);
+        CHECK(host_current_view() == GolfScoreViewSettings);
+        CHECK(host_canvas_has_text(host_render(), "Players"));
+        host_press(InputKeyBack);
+        CHECK(host_current_view() == GolfScoreViewSubmenu);
+    }
+
+    // The journal brings the edits and the undo history back
+    {
+        GolfScoreApp app;
+        app.runDispatcher();
+        CHECK(app.getScore(0, 0) == 3);
+        host_press(InputKeyOk);
+        host_long_press(InputKeyBack);
+        host_long_press(InputKeyRight);
+        CHECK(app.getScore(0, 0) == 4);
+    }
+
+    // Once a restart has folded the journal, the undo history it carries
+    // over (here with a redo pending) does not make every later open save
+    {
+        host_storage_wipe();
+        {
+            GolfScoreApp app;
+            GolfScoreHostAccess::loadState(app);
+            app.adjustScore(0, 0, 4);
+            app.adjustScore(0, 1, 5);
+            uint8_t player;
+            uint8_t hole;
+            CHECK(app.undoEdit(player, hole));
+        }
+        uint8_t folded;
+        {
+            GolfScoreApp app;
+            GolfScoreHostAccess::loadState(app);
+            folded = GolfScoreHostAccess::generation(app);
+        }
+
+        GolfScoreApp app;
+        host_storage_reset_stats();
+        GolfScoreHostAccess::loadState(app);
+        CHECK(GolfScoreHostAccess::generation(app) == folded && host_storage_stats()->writes == 0);
+        uint8_t player;
+        uint8_t hole;
+        CHECK(app.redoEdit(player, hole) && app.getScore(0, 1) == 5);
+    }
+
+    // A save whose journal reset fails leaves the old journal behind; edits
+    // after it must still survive a restart
+    {
+        host_storage_wipe();
+        char journal[256];
+        GolfScoreHostAccess::journalPath(journal, sizeof(journal));
+        {
+            GolfScoreApp app;
+            GolfScoreHostAccess::loadState(app);
+            app.adjustScore(0, 0, 4);
+            host_storage_fail_opens(journal, 1);
+            app.setPar(0, 3);
+            app.adjustScore(0, 1, 5);
+            app.adjustScore(0, 2, 6);
+        }
+
+        GolfScoreApp app;
+        GolfScoreHostAccess::loadState(app);
+        CHECK(app.getPar(0) == 3);
+        CHECK(app.getScore(0, 0) == 4 && app.getScore(0, 1) == 5 && app.getScore(0, 2) == 6);
+    }
+
+    // Out and In split each round size at its middle, and a restart's
+    // rebuild agrees with the per-stroke updates
+    for (uint8_t holes : {9, 18, 27, 36})
+    {
+        uint16_t out = 0;
+        uint16_t in = 0;
+        host_storage_wipe();
+        {
+            GolfScoreApp app;
+            GolfScoreHostAccess::loadState(app);
+            app.setHoleCount(holes);
+            for (uint8_t hole = 0; hole < holes; ++hole)
+            {
+                uint8_t strokes = static_cast<uint8_t>(1 + hole % 5);
+                app.adjustScore(0, hole, static_cast<int8_t>(strokes - app.getScore(0, hole)));
+                (hole < golf_score_front_holes(holes) ? out : in) += strokes;
+            }
+            const GolfScorePlayerAggregate &aggregate = GolfScoreHostAccess::aggregate(app, 0);
+            CHECK(aggregate.front == out && aggregate.back == in);
+        }
+        CHECK(holes == 9 ? in == 0 : golf_score_front_holes(holes) == (holes + 1) / 2);
+
+        GolfScoreApp app;
+        GolfScoreHostAccess::loadState(app);
+        const GolfScorePlayerAggregate &aggregate = GolfScoreHostAccess::aggregate(app, 0);
+        CHECK(aggregate.front == out && aggregate.back == in);
+    }
+
+    // Setting a stroke index swaps it with the hole that had it, so every
+    // index from 1 to the hole count stays on exactly one hole
+    {
+        host_storage_wipe();
+        GolfScoreApp app;
+        GolfScoreHostAccess::loadState(app);
+        app.setHoleCount(18);
+        app.setStrokeIndex(0, 5);
+        app.setStrokeIndex(17, 1);
+        CHECK(app.getStrokeIndex(0) == 5 && app.getStrokeIndex(4) == 18 && app.getStrokeIndex(17) == 1);
+        uint32_t seen = 0;
+        for (uint8_t hole = 0; hole < 18; ++hole)
+        {
+            seen |= 1u << (app.getStrokeIndex(hole) - 1);
+        }
+        CHECK(seen == (1u << 18) - 1);
+    }
+
+    // Dropping to 9 holes ranks the kept stroke indices 1-9 again, so a
+    // 10-handicap still gets 5 strokes, after a restart and an index edit too
+    {
+        host_storage_wipe();
+        {
+            GolfScoreApp app;
+            GolfScoreHostAccess::loadState(app);
+            app.setHoleCount(18);
+            for (uint8_t hole = 0; hole < 9; ++hole)
+            {
+                app.setStrokeIndex(hole, static_cast<uint8_t>(hole + 10));
+            }
+            app.setHandicap(0, 10);
+            for (uint8_t hole = 0; hole < 18; ++hole)
+            {
+                app.adjustScore(0, hole, static_cast<int8_t>(app.getPar(hole)));
+            }
+            CHECK(app.getNetRelativeToPar(0) == -10);
+            app.setHoleCount(9);
+            CHECK(app.getRelativeToPar(0) == 0 && app.getNetRelativeToPar(0) == -5);
+        }
+
+        GolfScoreApp app;
+        GolfScoreHostAccess::loadState(app);
+        CHECK(app.getHoleCount() == 9 && app.getNetRelativeToPar(0) == -5);
+        app.setStrokeIndex(0, 9);
+        CHECK(app.getNetRelativeToPar(0) == -5);
+    }
+
+    // Handicaps are for 18 holes; other round sizes get their share
+    struct Share
+    {
+        int8_t handicap;
+        uint8_t holes;
+        int expected;
+    };
+    for (const Share &share : {Share{13, 9, 7}, Share{13, 18, 13}, Share{13, 27, 20}, Share{13, 36, 26}, Share{-3, 9, -2}, Share{-3, 18, -3}})
+    {
+        int received = 0;
+        for (uint8_t index = 1; index <= share.holes; ++index)
+        {
+            received += golf_score_strokes_received(share.handicap, index, share.holes);
+        }
+        CHECK(received == share.expected);
+    }
+    CHECK(golf_score_strokes_received(13, 7, 9) == 1 && golf_score_strokes_received(13, 8, 9) == 0);
+    CHECK(golf_score_strokes_received(-3, 7, 9) == 0 && golf_score_strokes_received(-3, 8, 9) == -1);
+
+    puts("host smoke test passed");
+    return 0;
+}
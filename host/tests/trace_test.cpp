@@ -0,0 +1,119 @@
+// Runs a keypress, a save, an export and view switches through the app built
+// with GOLF_SCORE_TRACE and checks the trace.json it writes on exit.
+
+#include "app.hpp"
+#include "debug/trace.hpp"
+#include "host_shim.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define CHECK(expr)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(expr))                                                       \
+        {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            exit(1);                                                       \
+        }                                                                  \
+    } while (0)
+
+namespace
+{
+    std::string readTrace()
+    {
+        char path[256];
+        snprintf(path, sizeof(path), STORAGE_EXT_PATH_PREFIX "/apps_data/%s/data/trace.json", APP_ID);
+        Storage *storage = static_cast<Storage *>(furi_record_open(RECORD_STORAGE));
+        File *file = storage_file_alloc(storage);
+        std::string text;
+        if (storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING))
+        {
+            char buffer[256];
+            size_t count;
+            while ((count = storage_file_read(file, buffer, sizeof(buffer))) > 0)
+            {
+                text.append(buffer, count);
+            }
+        }
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+        return text;
+    }
+
+    size_t occurrences(const std::string &text, const char *needle)
+    {
+        size_t found = 0;
+        for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1))
+        {
+            ++found;
+        }
+        return found;
+    }
+}
+
+int main()
+{
+    host_log_set_level(FuriLogLevelError);
+    host_storage_wipe();
+    golf_score_trace_clear();
+
+    {
+        GolfScoreApp app;
+        app.runDispatcher();
+        app.setPlayerCount(2);
+        app.exportRoundHistory();
+
+        host_press(InputKeyOk);
+        host_press(InputKeyUp);
+        host_render();
+        host_press(InputKeyBack);
+        host_advance_ms(200);
+        CHECK(host_current_view() == GolfScoreViewSubmenu);
+        CHECK(golf_score_trace_count() > 0);
+    }
+
+    std::string trace = readTrace();
+    CHECK(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0);
+    CHECK(trace.size() > 4 && trace.compare(trace.size() - 3, 3, "]}\n") == 0);
+    for (const char *name : {"saveState", "exportRoundHistory", "scorecard_open", "updateInput", "updateDraw", "view_switch"})
+    {
+        std::string event = std::string("\"name\":\"") + name + "\"";
+        CHECK(occurrences(trace, event.c_str()) >= 2);
+    }
+    CHECK(occurrences(trace, "\"ph\":\"B\"") == occurrences(trace, "\"ph\":\"E\""));
+    CHECK(occurrences(trace, "\"args\":{\"value\":") > 0);
+
+    // Stamps are in recording order, so timestamps never go backwards
+    double last = 0;
+    for (size_t at = trace.find("\"ts\":"); at != std::string::npos; at = trace.find("\"ts\":", at + 1))
+    {
+        double ts = strtod(trace.c_str() + at + 5, nullptr);
+        CHECK(ts >= last);
+        last = ts;
+    }
+
+    // A full ring keeps the newest stamps and still balances
+    golf_score_trace_clear();
+    {
+        GolfScoreApp app;
+        app.runDispatcher();
+        host_press(InputKeyOk);
+        for (size_t i = 0; i < GolfScoreTraceCapacity; ++i)
+        {
+            host_press(InputKeyUp);
+        }
+        CHECK(golf_score_trace_count() == GolfScoreTraceCapacity);
+        host_press(InputKeyBack);
+        host_advance_ms(200);
+    }
+    trace = readTrace();
+    CHECK(occurrences(trace, "\"ph\":\"B\"") >= occurrences(trace, "\"ph\":\"E\""));
+    CHECK(occurrences(trace, "\"name\":") <= GolfScoreTraceCapacity);
+
+    host_storage_wipe();
+    puts("host trace test passed");
+    return 0;
+}
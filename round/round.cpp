@@ -0,0 +1,164 @@
+#include "round/round.hpp"
+#include "round/round_kernels.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+int8_t golf_score_strokes_received(int8_t handicap, uint8_t strokeIndex, uint8_t holes)
+{
+    if (holes == 0)
+    {
+        return 0;
+    }
+
+    // The round's share of the 18-hole handicap, halves away from scratch
+    int strokes = (std::abs(handicap) * holes + 9) / 18;
+    if (handicap >= 0)
+    {
+        return static_cast<int8_t>(strokes / holes + (strokeIndex <= strokes % holes ? 1 : 0));
+    }
+
+    return static_cast<int8_t>(-(strokes / holes + (strokeIndex > holes - strokes % holes ? 1 : 0)));
+}
+
+GolfScoreRound::GolfScoreRound() : kernelTable(&golf_score_select_round_kernels(0, 0))
+{
+}
+
+bool GolfScoreRound::resize(uint8_t playerCount, uint8_t holeCount)
+{
+    if (playerCount == players && holeCount == holes && names)
+    {
+        return true;
+    }
+
+    std::unique_ptr<char[]> newNames;
+    std::unique_ptr<int8_t[]> newHandicaps;
+    std::unique_ptr<uint8_t[]> newTeams;
+    std::unique_ptr<GolfScorePlayerAggregate[]> newAggregates;
+    if (playerCount != players || !names)
+    {
+        newNames = std::make_unique<char[]>(static_cast<size_t>(playerCount) * NameLength);
+        newHandicaps = std::make_unique<int8_t[]>(playerCount);
+        newTeams = std::make_unique<uint8_t[]>(playerCount);
+        newAggregates = std::make_unique<GolfScorePlayerAggregate[]>(playerCount);
+        if (!newNames || !newHandicaps || !newTeams || !newAggregates)
+        {
+            return false;
+        }
+    }
+
+    std::unique_ptr<uint8_t[]> newPars;
+    std::unique_ptr<uint8_t[]> newStrokeIndices;
+    if (holeCount != holes || !pars)
+    {
+        newPars = std::make_unique<uint8_t[]>(holeCount);
+        newStrokeIndices = std::make_unique<uint8_t[]>(holeCount);
+        if (!newPars || !newStrokeIndices)
+        {
+            return false;
+        }
+    }
+
+    auto newEntries = std::make_unique<GolfScoreHoleEntry[]>(static_cast<size_t>(holeCount) * playerCount);
+    auto newAllowances = std::make_unique<int8_t[]>(static_cast<size_t>(holeCount) * playerCount);
+    if (!newEntries || !newAllowances)
+    {
+        return false;
+    }
+
+    uint8_t keptPlayers = std::min(players, playerCount);
+    uint8_t keptHoles = std::min(holes, holeCount);
+    for (size_t hole = 0; hole < keptHoles; ++hole)
+    {
+        std::copy(entries.get() + hole * players, entries.get() + hole * players + keptPlayers, newEntries.get() + hole * playerCount);
+    }
+
+    if (newNames)
+    {
+        std::fill(newTeams.get(), newTeams.get() + playerCount, static_cast<uint8_t>(0xFF));
+        if (keptPlayers > 0)
+        {
+            memcpy(newNames.get(), names.get(), static_cast<size_t>(keptPlayers) * NameLength);
+            memcpy(newHandicaps.get(), handicaps.get(), keptPlayers);
+            memcpy(newTeams.get(), teams.get(), keptPlayers);
+            std::copy(aggregates.get(), aggregates.get() + keptPlayers, newAggregates.get());
+        }
+        names = std::move(newNames);
+        handicaps = std::move(newHandicaps);
+        teams = std::move(newTeams);
+        aggregates = std::move(newAggregates);
+    }
+
+    if (newPars)
+    {
+        std::fill(newPars.get(), newPars.get() + holeCount, GolfScoreDefaultPar);
+        for (uint8_t hole = 0; hole < holeCount; ++hole)
+        {
+            newStrokeIndices[hole] = static_cast<uint8_t>(hole + 1);
+        }
+        if (keptHoles > 0)
+        {
+            memcpy(newPars.get(), pars.get(), keptHoles);
+            memcpy(newStrokeIndices.get(), strokeIndices.get(), keptHoles);
+        }
+        pars = std::move(newPars);
+        strokeIndices = std::move(newStrokeIndices);
+    }
+
+    entries = std::move(newEntries);
+    allowances = std::move(newAllowances);
+    players = playerCount;
+    holes = holeCount;
+    kernelTable = &golf_score_select_round_kernels(players, holes);
+    rankStrokeIndices();
+    rebuildAllowances();
+    return true;
+}
+
+void GolfScoreRound::rankStrokeIndices()
+{
+    // 0 and anything past the hole count sort last
+    auto key = [this](uint8_t hole)
+    {
+        uint8_t index = strokeIndices[hole];
+        return (index >= 1 && index <= holes) ? index : 0xFF;
+    };
+
+    uint8_t ranks[GolfScoreMaxHoles];
+    for (uint8_t hole = 0; hole < holes; ++hole)
+    {
+        uint8_t rank = 1;
+        for (uint8_t other = 0; other < holes; ++other)
+        {
+            if (key(other) < key(hole) || (key(other) == key(hole) && other < hole))
+            {
+                ++rank;
+            }
+        }
+        ranks[hole] = rank;
+    }
+    memcpy(strokeIndices.get(), ranks, holes);
+}
+
+void GolfScoreRound::rebuildAllowances()
+{
+    for (uint8_t hole = 0; hole < holes; ++hole)
+    {
+        int8_t *row = allowances.get() + static_cast<size_t>(hole) * players;
+        for (uint8_t player = 0; player < players; ++player)
+        {
+            row[player] = golf_score_strokes_received(handicaps[player], strokeIndices[hole], holes);
+        }
+    }
+}
+
+void GolfScoreRound::clearStrokes()
+{
+    if (entries)
+    {
+        std::fill(entries.get(), entries.get() + static_cast<size_t>(holes) * players, GolfScoreHoleEntry{});
+    }
+    std::fill(aggregates.get(), aggregates.get() + players, GolfScorePlayerAggregate{});
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "golf_score_config.hpp"
+
+typedef enum
+{
+    GolfScoreFairwayNone = 0, // Not recorded, or a par 3
+    GolfScoreFairwayHit = 1,
+    GolfScoreFairwayMissed = 2,
+} GolfScoreFairway;
+
+// One player's card for one hole, packed into 16 bits.
+struct GolfScoreHoleEntry
+{
+    uint16_t strokes : 7;   // 0 = not played
+    uint16_t putts : 3;
+    uint16_t fairway : 2;   // GolfScoreFairway
+    uint16_t green : 1;     // Green in regulation
+    uint16_t penalties : 3;
+
+    bool operator==(const GolfScoreHoleEntry &) const = default;
+};
+static_assert(sizeof(GolfScoreHoleEntry) == 2, "hole entry must stay packed");
+
+typedef enum
+{
+    GolfScoreStatPutts = 0,
+    GolfScoreStatFairway = 1,
+    GolfScoreStatGreen = 2,
+    GolfScoreStatPenalties = 3,
+    GolfScoreStatCount = 4,
+} GolfScoreHoleStat;
+
+constexpr uint8_t GolfScoreMaxStrokes = 99;
+constexpr uint8_t GolfScoreMaxPutts = 7;
+constexpr uint8_t GolfScoreMaxPenalties = 7;
+
+// Brings fields a damaged state file or journal can hold back into range
+inline GolfScoreHoleEntry golf_score_valid_entry(GolfScoreHoleEntry entry)
+{
+    if (entry.strokes > GolfScoreMaxStrokes)
+    {
+        entry.strokes = GolfScoreMaxStrokes;
+    }
+    if (entry.fairway > GolfScoreFairwayMissed)
+    {
+        entry.fairway = GolfScoreFairwayNone;
+    }
+    return entry;
+}
+
+// Running per-player totals, kept in step with the hole entries so the
+// scorecard and round summary never have to rescan the holes.
+struct GolfScorePlayerAggregate
+{
+    uint16_t total = 0;
+    uint16_t parPlayed = 0; // Par of the holes with a score
+    uint16_t front = 0; // Out and In, split by golf_score_front_holes
+    uint16_t back = 0;
+    uint8_t played = 0;
+    uint8_t bestHole = 0xFF; // Lowest strokes-to-par, earliest on ties
+    int16_t net = 0;         // Strokes less handicap strokes received on the holes played
+    uint16_t putts = 0;
+    uint16_t penalties = 0;
+    uint8_t fairwaysHit = 0;
+    uint8_t fairwaysTracked = 0;
+    uint8_t greens = 0;
+
+    // Adds (sign 1) or removes (sign -1) the detail stats of one entry
+    void countDetails(GolfScoreHoleEntry entry, int sign)
+    {
+        putts = static_cast<uint16_t>(putts + sign * entry.putts);
+        penalties = static_cast<uint16_t>(penalties + sign * entry.penalties);
+        fairwaysHit = static_cast<uint8_t>(fairwaysHit + sign * (entry.fairway == GolfScoreFairwayHit));
+        fairwaysTracked = static_cast<uint8_t>(fairwaysTracked + sign * (entry.fairway != GolfScoreFairwayNone));
+        greens = static_cast<uint8_t>(greens + sign * entry.green);
+    }
+};
+
+struct GolfScoreRoundKernels;
+
+// Handicap strokes a player receives on a hole. Handicaps are for 18 holes,
+// so a round gets its share, rounded to the nearest stroke: half over 9
+// holes, twice over 36. Those strokes give one per full round of the course,
+// plus one more on the holes whose stroke index is within the remainder.
+// Plus (negative) handicaps give strokes back from the highest stroke index
+// down.
+int8_t golf_score_strokes_received(int8_t handicap, uint8_t strokeIndex, uint8_t holes);
+
+// Holes that count as Out on the summary: the first half of the round, the
+// odd hole of a 27-hole round included. A 9-hole round is all Out.
+constexpr uint8_t golf_score_front_holes(uint8_t holes)
+{
+    return holes > 9 ? static_cast<uint8_t>((holes + 1) / 2) : holes;
+}
+
+// Player data for the round in play, stored as parallel arrays sized to the
+// players and holes actually in the round. Hole entries are hole-major so
+// every player's card for one hole is contiguous.
+class GolfScoreRound
+{
+public:
+    static constexpr size_t NameLength = GolfScoreMaxNameLength;
+
+private:
+    uint8_t players = 0;
+    uint8_t holes = 0;
+    std::unique_ptr<char[]> names;                         // players x NameLength
+    std::unique_ptr<uint8_t[]> pars;                       // holes
+    std::unique_ptr<uint8_t[]> strokeIndices;              // holes, 1 = hardest
+    std::unique_ptr<int8_t[]> handicaps;                   // players, course handicap
+    std::unique_ptr<uint8_t[]> teams;                      // players, team id or 0xFF
+    std::unique_ptr<int8_t[]> allowances;                  // holes x players, strokes received
+    std::unique_ptr<GolfScoreHoleEntry[]> entries;         // holes x players
+    std::unique_ptr<GolfScorePlayerAggregate[]> aggregates; // players
+    const GolfScoreRoundKernels *kernelTable;              // Chosen for players x holes
+
+public:
+    GolfScoreRound();
+
+    // Changes the number of players and holes, keeping the names, pars and
+    // strokes that remain. New players start with an empty name, no
+    // strokes, no handicap and no team; new holes start at the default par with the
+    // hole number as stroke index. The stroke indices are ranked again.
+    bool resize(uint8_t playerCount, uint8_t holeCount);
+    void clearStrokes();
+
+    // Renumbers the stroke indices 1..holes in their current order, so they
+    // stay a ranking after a resize drops holes or a file holds duplicates or
+    // indices out of range (those rank after the valid ones, by hole).
+    void rankStrokeIndices();
+
+    // Recomputes the strokes-received table from the handicaps and stroke
+    // indices. Done whenever either changes, never per stroke.
+    void rebuildAllowances();
+
+    uint8_t playerCount() const noexcept { return players; }
+    uint8_t holeCount() const noexcept { return holes; }
+    const GolfScoreRoundKernels &kernels() const noexcept { return *kernelTable; }
+
+    char *name(uint8_t player) noexcept { return names.get() + static_cast<size_t>(player) * NameLength; }
+    const char *name(uint8_t player) const noexcept { return names.get() + static_cast<size_t>(player) * NameLength; }
+
+    GolfScoreHoleEntry &entry(uint8_t player, uint8_t hole) noexcept { return entries[static_cast<size_t>(hole) * players + player]; }
+    const GolfScoreHoleEntry &entry(uint8_t player, uint8_t hole) const noexcept { return entries[static_cast<size_t>(hole) * players + player]; }
+    uint8_t getStrokes(uint8_t player, uint8_t hole) const noexcept { return entry(player, hole).strokes; }
+    void setStrokes(uint8_t player, uint8_t hole, uint8_t value) noexcept { entry(player, hole).strokes = value; }
+
+    uint8_t getPar(uint8_t hole) const noexcept { return pars[hole]; }
+    void setPar(uint8_t hole, uint8_t value) noexcept { pars[hole] = value; }
+    uint8_t getStrokeIndex(uint8_t hole) const noexcept { return strokeIndices[hole]; }
+    void setStrokeIndex(uint8_t hole, uint8_t value) noexcept { strokeIndices[hole] = value; }
+    int8_t getHandicap(uint8_t player) const noexcept { return handicaps[player]; }
+    void setHandicap(uint8_t player, int8_t value) noexcept { handicaps[player] = value; }
+    uint8_t getTeam(uint8_t player) const noexcept { return teams[player]; }
+    void setTeam(uint8_t player, uint8_t team) noexcept { teams[player] = team; }
+
+    int8_t allowance(uint8_t player, uint8_t hole) const noexcept { return allowances[static_cast<size_t>(hole) * players + player]; }
+    // Net score for `strokes` on hole; 0 stays 0 (not played)
+    int netStrokes(uint8_t player, uint8_t hole, uint8_t strokes) const noexcept { return strokes == 0 ? 0 : strokes - allowance(player, hole); }
+
+    GolfScorePlayerAggregate &aggregate(uint8_t player) noexcept { return aggregates[player]; }
+    const GolfScorePlayerAggregate &aggregate(uint8_t player) const noexcept { return aggregates[player]; }
+
+    // Raw blocks for persistence
+    char *nameData() noexcept { return names.get(); }
+    const char *nameData() const noexcept { return names.get(); }
+    size_t nameBytes() const noexcept { return static_cast<size_t>(players) * NameLength; }
+    uint8_t *parData() noexcept { return pars.get(); }
+    const uint8_t *parData() const noexcept { return pars.get(); }
+    size_t parBytes() const noexcept { return holes; }
+    uint8_t *strokeIndexData() noexcept { return strokeIndices.get(); }
+    const uint8_t *strokeIndexData() const noexcept { return strokeIndices.get(); }
+    size_t strokeIndexBytes() const noexcept { return holes; }
+    int8_t *handicapData() noexcept { return handicaps.get(); }
+    const int8_t *handicapData() const noexcept { return handicaps.get(); }
+    size_t handicapBytes() const noexcept { return players; }
+    uint8_t *teamData() noexcept { return teams.get(); }
+    const uint8_t *teamData() const noexcept { return teams.get(); }
+    size_t teamBytes() const noexcept { return players; }
+    const int8_t *allowanceData() const noexcept { return allowances.get(); }
+    GolfScoreHoleEntry *entryData() noexcept { return entries.get(); }
+    const GolfScoreHoleEntry *entryData() const noexcept { return entries.get(); }
+    size_t entryBytes() const noexcept { return static_cast<size_t>(holes) * players * sizeof(GolfScoreHoleEntry); }
+};
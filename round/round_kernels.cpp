@@ -0,0 +1,34 @@
+#include "round/round_kernels.hpp"
+
+namespace
+{
+    constexpr uint8_t SpecialisedPlayers = 4;
+
+    template <uint8_t Holes>
+    const GolfScoreRoundKernels &select_for_holes(uint8_t players)
+    {
+        static constexpr const GolfScoreRoundKernels *tables[SpecialisedPlayers] = {
+            &GolfScoreRoundKernel<1, Holes>::table,
+            &GolfScoreRoundKernel<2, Holes>::table,
+            &GolfScoreRoundKernel<3, Holes>::table,
+            &GolfScoreRoundKernel<4, Holes>::table,
+        };
+        return *tables[players - 1];
+    }
+}
+
+const GolfScoreRoundKernels &golf_score_select_round_kernels(uint8_t players, uint8_t holes)
+{
+    if (players >= 1 && players <= SpecialisedPlayers)
+    {
+        if (holes == 9)
+        {
+            return select_for_holes<9>(players);
+        }
+        if (holes == 18)
+        {
+            return select_for_holes<18>(players);
+        }
+    }
+    return GolfScoreRoundKernel<0, 0>::table;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "round/round.hpp"
+
+// Scoring loops over a round, picked once per round size. Every entry
+// assumes the round has the size it was selected for.
+struct GolfScoreRoundKernels
+{
+    void (*rebuildAggregate)(GolfScoreRound &round, uint8_t player);
+    void (*rebuildAggregates)(GolfScoreRound &round);
+    bool (*isComplete)(const GolfScoreRound &round);
+    uint16_t (*coursePar)(const GolfScoreRound &round);
+};
+
+// Kernels for the common sizes get Players/Holes as constants so the loops
+// have fixed trip counts; 0 means the size is read from the round instead.
+template <uint8_t Players, uint8_t Holes>
+struct GolfScoreRoundKernel
+{
+    static uint8_t players(const GolfScoreRound &round) { return Players ? Players : round.playerCount(); }
+    static uint8_t holes(const GolfScoreRound &round) { return Holes ? Holes : round.holeCount(); }
+
+    static void rebuildAggregate(GolfScoreRound &round, uint8_t player)
+    {
+        GolfScorePlayerAggregate aggregate{};
+        const GolfScoreHoleEntry *entries = round.entryData() + player;
+        const int8_t *allowances = round.allowanceData() + player;
+        const uint8_t *pars = round.parData();
+        const uint8_t stride = players(round);
+
+        const uint8_t front = golf_score_front_holes(holes(round));
+        int best = 0;
+        for (uint8_t hole = 0; hole < holes(round); ++hole)
+        {
+            GolfScoreHoleEntry entry = entries[static_cast<size_t>(hole) * stride];
+            aggregate.countDetails(entry, 1);
+
+            uint8_t value = entry.strokes;
+            if (value == 0)
+            {
+                continue;
+            }
+
+            aggregate.total += value;
+            aggregate.net = static_cast<int16_t>(aggregate.net + value - allowances[static_cast<size_t>(hole) * stride]);
+            aggregate.parPlayed += pars[hole];
+            (hole < front ? aggregate.front : aggregate.back) += value;
+            ++aggregate.played;
+
+            int relative = static_cast<int>(value) - pars[hole];
+            if (aggregate.bestHole == 0xFF || relative < best)
+            {
+                aggregate.bestHole = hole;
+                best = relative;
+            }
+        }
+        round.aggregate(player) = aggregate;
+    }
+
+    static void rebuildAggregates(GolfScoreRound &round)
+    {
+        for (uint8_t player = 0; player < players(round); ++player)
+        {
+            rebuildAggregate(round, player);
+        }
+    }
+
+    static bool isComplete(const GolfScoreRound &round)
+    {
+        // Hole-major entries: the whole card is one contiguous block
+        const GolfScoreHoleEntry *entries = round.entryData();
+        const size_t count = static_cast<size_t>(players(round)) * holes(round);
+        return std::none_of(entries, entries + count, [](GolfScoreHoleEntry entry)
+                            { return entry.strokes == 0; });
+    }
+
+    static uint16_t coursePar(const GolfScoreRound &round)
+    {
+        const uint8_t *pars = round.parData();
+        uint16_t total = 0;
+        for (uint8_t hole = 0; hole < holes(round); ++hole)
+        {
+            total += pars[hole];
+        }
+        return total;
+    }
+
+    static constexpr GolfScoreRoundKernels table{rebuildAggregate, rebuildAggregates, isComplete, coursePar};
+};
+
+// Specialised table for 1-4 players over 9 or 18 holes, the generic one otherwise.
+const GolfScoreRoundKernels &golf_score_select_round_kernels(uint8_t players, uint8_t holes);
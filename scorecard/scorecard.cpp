@@ -1,5 +1,7 @@
 #include "scorecard/scorecard.hpp"
 #include "app.hpp"
+#include "debug/trace.hpp"
+#include "debug/perf_counters.hpp"
 
 #include <algorithm>
 #include <cstdio>
@@ -37,6 +39,7 @@ void GolfScoreScorecard::clampSelection()
 
 void GolfScoreScorecard::updateDraw(Canvas *canvas)
 {
+    GOLF_SCORE_TRACE_SCOPE("updateDraw");
     auto *app = static_cast<GolfScoreApp *>(appContext);
     if (!app || !canvas)
     {
@@ -57,10 +60,19 @@ void GolfScoreScorecard::updateDraw(Canvas *canvas)
     snprintf(par_text, sizeof(par_text), "Par %u", static_cast<unsigned>(app->getPar(activeHole)));
     canvas_draw_str(canvas, 98, 13, par_text);
 
+    if (statsMode)
+    {
+        drawStats(canvas, app);
+        drawPerfHud(canvas);
+        return;
+    }
+
     canvas_set_font_custom(canvas, FONT_SIZE_MEDIUM);
     uint8_t y = 26;
     uint8_t playerCount = app->getPlayerCount();
-    for (uint8_t index = 0; index < playerCount; ++index)
+    uint8_t first = static_cast<uint8_t>(activePlayer - activePlayer % PageRows);
+    uint8_t last = static_cast<uint8_t>(std::min<unsigned>(playerCount, first + PageRows));
+    for (uint8_t index = first; index < last; ++index)
     {
         bool highlight = index == activePlayer;
 
@@ -84,39 +96,11 @@ void GolfScoreScorecard::updateDraw(Canvas *canvas)
             snprintf(holeScore, sizeof(holeScore), "%u", strokes);
         }
 
-        char totalStr[8];
-        uint16_t total = app->getTotalScore(index);
-        if (total == 0)
-        {
-            strcpy(totalStr, "--");
-        }
-        else
-        {
-            snprintf(totalStr, sizeof(totalStr), "%u", total);
-        }
-
-        char relation[8];
-        uint8_t played = app->getPlayedHoleCount(index);
-        int16_t rel = app->getRelativeToPar(index);
-        if (played == 0)
-        {
-            strcpy(relation, "--");
-        }
-        else if (rel == 0)
-        {
-            strcpy(relation, "E");
-        }
-        else if (rel > 0)
-        {
-            snprintf(relation, sizeof(relation), "+%d", rel);
-        }
-        else
-        {
-            snprintf(relation, sizeof(relation), "%d", rel);
-        }
+        char standing[16];
+        app->getStanding(index, standing, sizeof(standing));
 
         char line[64];
-        snprintf(line, sizeof(line), "%c%-8s Stk%-2s Tot%-3s %s", highlight ? '>' : ' ', name, holeScore, totalStr, relation);
+        snprintf(line, sizeof(line), "%c%-8s Stk%-2s %s", highlight ? '>' : ' ', name, holeScore, standing);
 
         if (highlight)
         {
@@ -141,12 +125,150 @@ void GolfScoreScorecard::updateDraw(Canvas *canvas)
 
     canvas_set_font_custom(canvas, FONT_SIZE_SMALL);
     char footer[64];
-    snprintf(footer, sizeof(footer), "Up/Down +/-   OK next (P%u)", static_cast<unsigned>(activePlayer + 1));
+    const GolfScoreTeams &teams = app->getTeams();
+    uint8_t team = app->getTeam(activePlayer);
+    if (teams.active() && team < teams.count())
+    {
+        // The active player's side stands in for the key hints
+        char relative[8];
+        int toPar = teams.relative(team);
+        snprintf(relative, sizeof(relative), toPar == 0 ? "E" : "%+d", toPar);
+        snprintf(footer, sizeof(footer), "Team %c %d %s  #%u/%u (P%u)", GolfScoreTeams::letter(team), teams.total(team).total, relative,
+                 static_cast<unsigned>(teams.rank(team)), static_cast<unsigned>(teams.count()), static_cast<unsigned>(activePlayer + 1));
+    }
+    else if (playerCount > PageRows)
+    {
+        snprintf(footer, sizeof(footer), "Up/Down +/-   OK next (P%u/%u)", static_cast<unsigned>(activePlayer + 1), static_cast<unsigned>(playerCount));
+    }
+    else
+    {
+        snprintf(footer, sizeof(footer), "Up/Down +/-   OK next (P%u)", static_cast<unsigned>(activePlayer + 1));
+    }
     canvas_draw_str(canvas, 0, 63, footer);
+    drawPerfHud(canvas);
+}
+
+void GolfScoreScorecard::drawPerfHud(Canvas *canvas)
+{
+    if (!perfHud)
+    {
+        return;
+    }
+
+    // One inverted row over the footer: input-to-draw, last save, SD
+    // bytes written this session, free heap
+    uint32_t input = golf_score_perf.inputToDrawUs / 100;
+    uint32_t save = golf_score_perf.saveUs / 100;
+    uint32_t written = golf_score_perf.sdBytesWritten;
+    char line[48];
+    snprintf(line, sizeof(line), "in%lu.%lu sv%lu.%lu sd%lu%c hp%luK",
+             static_cast<unsigned long>(input / 10), static_cast<unsigned long>(input % 10),
+             static_cast<unsigned long>(save / 10), static_cast<unsigned long>(save % 10),
+             static_cast<unsigned long>(written < 10240 ? written : written / 1024), written < 10240 ? 'B' : 'K',
+             static_cast<unsigned long>(memmgr_get_free_heap() / 1024));
+
+    canvas_set_font_custom(canvas, FONT_SIZE_SMALL);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_draw_box(canvas, 0, 57, 128, 7);
+    canvas_set_color(canvas, ColorWhite);
+    canvas_draw_str(canvas, 1, 63, line);
+    canvas_set_color(canvas, ColorBlack);
+}
+
+void GolfScoreScorecard::drawStats(Canvas *canvas, GolfScoreApp *app)
+{
+    GolfScoreHoleEntry entry = app->getHoleEntry(activePlayer, activeHole);
+
+    canvas_set_font_custom(canvas, FONT_SIZE_MEDIUM);
+    char line[32];
+    snprintf(line, sizeof(line), "%.10s", app->getPlayerName(activePlayer));
+    canvas_draw_str(canvas, 2, 24, line);
+
+    static const char *const fairways[] = {"--", "Hit", "Miss"};
+    uint8_t y = 24;
+    for (uint8_t stat = 0; stat < GolfScoreStatCount; ++stat)
+    {
+        switch (stat)
+        {
+        case GolfScoreStatPutts:
+            snprintf(line, sizeof(line), "Putts %u", static_cast<unsigned>(entry.putts));
+            break;
+        case GolfScoreStatFairway:
+            snprintf(line, sizeof(line), "FW %s", fairways[entry.fairway < 3 ? entry.fairway : 0]);
+            break;
+        case GolfScoreStatGreen:
+            snprintf(line, sizeof(line), "GIR %s", entry.green ? "Yes" : "No");
+            break;
+        default:
+            snprintf(line, sizeof(line), "Pen %u", static_cast<unsigned>(entry.penalties));
+            break;
+        }
+
+        // Stats sit in the right column, one row each
+        bool highlight = stat == activeStat;
+        if (highlight)
+        {
+            canvas_draw_box(canvas, 64, y - 8, 64, 10);
+            canvas_set_color(canvas, ColorWhite);
+        }
+        canvas_draw_str(canvas, 66, y, line);
+        if (highlight)
+        {
+            canvas_set_color(canvas, ColorBlack);
+        }
+        y += 10;
+    }
+
+    canvas_set_font_custom(canvas, FONT_SIZE_SMALL);
+    canvas_draw_str(canvas, 0, 63, "L/R change  OK next  Back done");
+}
+
+void GolfScoreScorecard::statsInput(InputEvent *event, GolfScoreApp *app)
+{
+    if (event->type != InputTypeShort && event->type != InputTypeRepeat)
+    {
+        return;
+    }
+
+    auto stat = static_cast<GolfScoreHoleStat>(activeStat);
+    switch (event->key)
+    {
+    case InputKeyUp:
+        activeStat = activeStat == 0 ? GolfScoreStatCount - 1 : activeStat - 1;
+        app->requestCanvasRefresh();
+        break;
+    case InputKeyDown:
+        activeStat = static_cast<uint8_t>((activeStat + 1) % GolfScoreStatCount);
+        app->requestCanvasRefresh();
+        break;
+    case InputKeyLeft:
+        app->adjustStat(activePlayer, activeHole, stat, -1);
+        break;
+    case InputKeyRight:
+        app->adjustStat(activePlayer, activeHole, stat, 1);
+        break;
+    case InputKeyOk:
+    {
+        uint8_t playerCount = std::max<uint8_t>(1, app->getPlayerCount());
+        activePlayer = static_cast<uint8_t>((activePlayer + 1) % playerCount);
+        app->requestCanvasRefresh();
+        break;
+    }
+    case InputKeyBack:
+        if (event->type == InputTypeShort)
+        {
+            statsMode = false;
+            app->requestCanvasRefresh();
+        }
+        break;
+    default:
+        break;
+    }
 }
 
 void GolfScoreScorecard::updateInput(InputEvent *event)
 {
+    GOLF_SCORE_TRACE_SCOPE("updateInput");
     if (!event)
     {
         return;
@@ -160,6 +282,56 @@ void GolfScoreScorecard::updateInput(InputEvent *event)
 
     clampSelection();
 
+    // Holding OK on the stats page toggles the performance HUD; the repeats
+    // of that hold must not cycle players
+    if (statsMode && event->key == InputKeyOk && event->type == InputTypeLong)
+    {
+        perfHud = !perfHud;
+        perfHudKeyHeld = true;
+        app->requestCanvasRefresh();
+        return;
+    }
+    if (perfHudKeyHeld && event->key == InputKeyOk)
+    {
+        perfHudKeyHeld = event->type != InputTypeRelease;
+        return;
+    }
+
+    if (event->type == InputTypeLong && event->key == InputKeyBack)
+    {
+        statsMode = !statsMode;
+        app->requestCanvasRefresh();
+        return;
+    }
+
+    // Holding Left/Right on the stats page undoes/redoes the last hole edit
+    // and selects the hole it touched. Stats step by short presses, so the
+    // hold's repeats are dropped; on the strokes page a hold scrolls holes.
+    if (statsMode && (event->key == InputKeyLeft || event->key == InputKeyRight) && event->type == InputTypeLong)
+    {
+        uint8_t player = activePlayer;
+        uint8_t hole = activeHole;
+        if (event->key == InputKeyLeft ? app->undoEdit(player, hole) : app->redoEdit(player, hole))
+        {
+            activePlayer = player;
+            activeHole = hole;
+            app->requestCanvasRefresh();
+        }
+        undoKeyHeld = true;
+        return;
+    }
+    if (undoKeyHeld && (event->key == InputKeyLeft || event->key == InputKeyRight))
+    {
+        undoKeyHeld = event->type != InputTypeRelease;
+        return;
+    }
+
+    if (statsMode)
+    {
+        statsInput(event, app);
+        return;
+    }
+
     if (event->type == InputTypeShort || event->type == InputTypeRepeat)
     {
         switch (event->key)
@@ -9,12 +9,22 @@ class GolfScoreApp;
 class GolfScoreScorecard
 {
 private:
+    static constexpr uint8_t PageRows = 4; // Player rows per page; OK pages on past the last
+
     void *appContext;
     bool shouldReturnToMenu;
     uint8_t activeHole = 0;
     uint8_t activePlayer = 0;
+    bool statsMode = false;  // Long Back toggles putts/fairway/GIR/penalty entry
+    uint8_t activeStat = 0;  // GolfScoreHoleStat
+    bool perfHud = false;    // Long OK on the stats page toggles the latency/SD/heap row
+    bool perfHudKeyHeld = false;
+    bool undoKeyHeld = false; // Long Left/Right on the stats page undoes/redoes
 
     void clampSelection();
+    void drawStats(Canvas *canvas, GolfScoreApp *app);
+    void drawPerfHud(Canvas *canvas);
+    void statsInput(InputEvent *event, GolfScoreApp *app);
 
 public:
     GolfScoreScorecard(void *appContext);
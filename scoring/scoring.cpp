@@ -0,0 +1,357 @@
+#include "scoring/scoring.hpp"
+
+#include <array>
+#include <cstdio>
+
+namespace
+{
+    constexpr size_t MaxPairs = GolfScoreMaxPlayers / 2;
+
+    const char *const FormatNames[GolfScoreFormatCount] = {"Stroke", "Stableford", "Skins", "Match", "Nassau"};
+
+    class StablefordFormat : public GolfScoreFormat
+    {
+    private:
+        std::array<uint16_t, GolfScoreMaxPlayers> points{};
+
+        // Two points for a net par, one more per stroke under, none at net
+        // double bogey or worse
+        static uint8_t holePoints(const GolfScoreRound &round, uint8_t player, uint8_t hole, uint8_t strokes)
+        {
+            int value = 2 + static_cast<int>(round.getPar(hole)) - round.netStrokes(player, hole, strokes);
+            return strokes == 0 || value < 0 ? 0 : static_cast<uint8_t>(value);
+        }
+
+    public:
+        void reset(const GolfScoreRound &round) override
+        {
+            points.fill(0);
+            for (uint8_t hole = 0; hole < round.holeCount(); ++hole)
+            {
+                for (uint8_t player = 0; player < round.playerCount(); ++player)
+                {
+                    points[player] += holePoints(round, player, hole, round.getStrokes(player, hole));
+                }
+            }
+        }
+
+        void update(const GolfScoreRound &round, uint8_t player, uint8_t hole, uint8_t previous) override
+        {
+            points[player] = static_cast<uint16_t>(points[player] - holePoints(round, player, hole, previous) +
+                                                   holePoints(round, player, hole, round.getStrokes(player, hole)));
+        }
+
+        void standing(const GolfScoreRound &, uint8_t player, char *out, size_t size) const override
+        {
+            snprintf(out, size, "Pts %u", static_cast<unsigned>(points[player]));
+        }
+    };
+
+    // A hole is won outright by the single lowest net score once everyone
+    // has played it. Tied holes carry their skin into the next hole won.
+    class SkinsFormat : public GolfScoreFormat
+    {
+    private:
+        static constexpr int8_t Open = -2;
+        static constexpr int8_t Tied = -1;
+
+        std::array<int8_t, GolfScoreMaxHoles> outcome{}; // Winner, Tied or Open
+        std::array<uint16_t, GolfScoreMaxPlayers> skins{};
+        uint8_t holes = 0;
+
+        static int8_t decide(const GolfScoreRound &round, uint8_t hole)
+        {
+            int best = 0;
+            int8_t winner = Tied;
+            for (uint8_t player = 0; player < round.playerCount(); ++player)
+            {
+                uint8_t gross = round.getStrokes(player, hole);
+                if (gross == 0)
+                {
+                    return Open;
+                }
+                int strokes = round.netStrokes(player, hole, gross);
+                if (player == 0 || strokes < best)
+                {
+                    best = strokes;
+                    winner = static_cast<int8_t>(player);
+                }
+                else if (strokes == best)
+                {
+                    winner = Tied;
+                }
+            }
+            return winner;
+        }
+
+        // Adds (sign 1) or removes (sign -1) the skins hole pays out
+        void credit(uint8_t hole, int sign)
+        {
+            if (hole >= holes || outcome[hole] < 0)
+            {
+                return;
+            }
+
+            uint16_t pot = 1;
+            for (uint8_t before = hole; before > 0 && outcome[before - 1] == Tied; --before)
+            {
+                ++pot;
+            }
+            skins[outcome[hole]] = static_cast<uint16_t>(skins[outcome[hole]] + sign * pot);
+        }
+
+    public:
+        void reset(const GolfScoreRound &round) override
+        {
+            holes = round.holeCount();
+            skins.fill(0);
+            for (uint8_t hole = 0; hole < holes; ++hole)
+            {
+                outcome[hole] = decide(round, hole);
+            }
+            for (uint8_t hole = 0; hole < holes; ++hole)
+            {
+                credit(hole, 1);
+            }
+        }
+
+        void update(const GolfScoreRound &round, uint8_t, uint8_t hole, uint8_t) override
+        {
+            int8_t next = decide(round, hole);
+            if (next == outcome[hole])
+            {
+                return;
+            }
+
+            // Only this hole and the next hole not tied can change hands
+            uint8_t carried = static_cast<uint8_t>(hole + 1);
+            while (carried < holes && outcome[carried] == Tied)
+            {
+                ++carried;
+            }
+
+            credit(hole, -1);
+            credit(carried, -1);
+            outcome[hole] = next;
+            credit(hole, 1);
+            credit(carried, 1);
+        }
+
+        void standing(const GolfScoreRound &, uint8_t player, char *out, size_t size) const override
+        {
+            snprintf(out, size, "Skins %u", static_cast<unsigned>(skins[player]));
+        }
+    };
+
+    // Pairs players 1v2, 3v4, ...; an odd player out has no match. Hole
+    // results are recomputed from the pair's two scores, so no per-hole
+    // state is kept.
+    class PairFormat : public GolfScoreFormat
+    {
+    protected:
+        static bool opponentOf(const GolfScoreRound &round, uint8_t player, uint8_t &opponent)
+        {
+            opponent = static_cast<uint8_t>(player ^ 1);
+            return opponent < round.playerCount();
+        }
+
+        // 1 if the pair's first player won the hole on net, -1 if the
+        // second did; `first`/`second` are gross strokes
+        static int holeResult(const GolfScoreRound &round, uint8_t pair, uint8_t hole, uint8_t first, uint8_t second)
+        {
+            if (first == 0 || second == 0)
+            {
+                return 0;
+            }
+            int a = round.netStrokes(pair * 2, hole, first);
+            int b = round.netStrokes(pair * 2 + 1, hole, second);
+            return a == b ? 0 : a < b ? 1 : -1;
+        }
+
+        virtual void clear() {}
+        virtual void apply(uint8_t /*pair*/, uint8_t /*hole*/, uint8_t /*holes*/, int /*result*/, int /*decided*/) {}
+
+    public:
+        void reset(const GolfScoreRound &round) override
+        {
+            clear();
+            for (uint8_t first = 0; first + 1 < round.playerCount(); first += 2)
+            {
+                for (uint8_t hole = 0; hole < round.holeCount(); ++hole)
+                {
+                    uint8_t a = round.getStrokes(first, hole);
+                    uint8_t b = round.getStrokes(first + 1, hole);
+                    apply(first / 2, hole, round.holeCount(), holeResult(round, first / 2, hole, a, b), a != 0 && b != 0);
+                }
+            }
+        }
+
+        void update(const GolfScoreRound &round, uint8_t player, uint8_t hole, uint8_t previous) override
+        {
+            uint8_t opponent;
+            if (!opponentOf(round, player, opponent))
+            {
+                return;
+            }
+
+            uint8_t other = round.getStrokes(opponent, hole);
+            uint8_t current = round.getStrokes(player, hole);
+            uint8_t pair = player / 2;
+            bool first = (player & 1) == 0;
+            int before = first ? holeResult(round, pair, hole, previous, other) : holeResult(round, pair, hole, other, previous);
+            int after = first ? holeResult(round, pair, hole, current, other) : holeResult(round, pair, hole, other, current);
+            int decided = (current != 0 && other != 0) - (previous != 0 && other != 0);
+            apply(pair, hole, round.holeCount(), after - before, decided);
+        }
+    };
+
+    class MatchFormat : public PairFormat
+    {
+    private:
+        std::array<int8_t, MaxPairs> up{};      // Holes up for the pair's first player
+        std::array<uint8_t, MaxPairs> decided{}; // Holes both players have scored
+
+    protected:
+        void clear() override
+        {
+            up.fill(0);
+            decided.fill(0);
+        }
+
+        void apply(uint8_t pair, uint8_t, uint8_t, int result, int played) override
+        {
+            up[pair] = static_cast<int8_t>(up[pair] + result);
+            decided[pair] = static_cast<uint8_t>(decided[pair] + played);
+        }
+
+    public:
+
+        void standing(const GolfScoreRound &round, uint8_t player, char *out, size_t size) const override
+        {
+            uint8_t opponent;
+            if (!opponentOf(round, player, opponent))
+            {
+                snprintf(out, size, "No match");
+                return;
+            }
+
+            uint8_t pair = player / 2;
+            int lead = (player & 1) == 0 ? up[pair] : -up[pair];
+            int remaining = round.holeCount() - decided[pair];
+            int margin = lead < 0 ? -lead : lead;
+            if (margin > remaining)
+            {
+                // Match closed out, e.g. "W 3&2"
+                if (remaining > 0)
+                {
+                    snprintf(out, size, "%c %d&%d", lead > 0 ? 'W' : 'L', margin, remaining);
+                }
+                else
+                {
+                    snprintf(out, size, "%c %d UP", lead > 0 ? 'W' : 'L', margin);
+                }
+            }
+            else if (lead == 0)
+            {
+                snprintf(out, size, "AS");
+            }
+            else
+            {
+                snprintf(out, size, "%d %s", margin, lead > 0 ? "UP" : "DN");
+            }
+        }
+    };
+
+    class NassauFormat : public PairFormat
+    {
+    private:
+        enum
+        {
+            Front = 0,
+            Back = 1,
+            Overall = 2,
+        };
+
+        std::array<std::array<int8_t, 3>, MaxPairs> up{};
+
+    protected:
+        void apply(uint8_t pair, uint8_t hole, uint8_t holes, int result, int) override
+        {
+            // Odd-length rounds give the extra hole to the front
+            uint8_t half = static_cast<uint8_t>((holes + 1) / 2);
+            int8_t &segment = up[pair][hole < half ? Front : Back];
+            segment = static_cast<int8_t>(segment + result);
+            up[pair][Overall] = static_cast<int8_t>(up[pair][Overall] + result);
+        }
+
+        void clear() override
+        {
+            for (auto &pair : up)
+            {
+                pair.fill(0);
+            }
+        }
+
+    public:
+
+        void standing(const GolfScoreRound &round, uint8_t player, char *out, size_t size) const override
+        {
+            uint8_t opponent;
+            if (!opponentOf(round, player, opponent))
+            {
+                snprintf(out, size, "No match");
+                return;
+            }
+
+            int sign = (player & 1) == 0 ? 1 : -1;
+            const auto &pair = up[player / 2];
+            snprintf(out, size, "%+d/%+d/%+d", sign * pair[Front], sign * pair[Back], sign * pair[Overall]);
+        }
+    };
+}
+
+// Stroke play: the totals already live in the round aggregates. Players
+// with a handicap are shown net.
+void GolfScoreFormat::standing(const GolfScoreRound &round, uint8_t player, char *out, size_t size) const
+{
+    const GolfScorePlayerAggregate &aggregate = round.aggregate(player);
+    const char *label = round.getHandicap(player) != 0 ? "Net" : "Tot";
+    if (aggregate.played == 0)
+    {
+        snprintf(out, size, "%s--  --", label);
+        return;
+    }
+
+    int total = round.getHandicap(player) != 0 ? aggregate.net : aggregate.total;
+    int relative = total - aggregate.parPlayed;
+    if (relative == 0)
+    {
+        snprintf(out, size, "%s%-3d E", label, total);
+    }
+    else
+    {
+        snprintf(out, size, "%s%-3d %+d", label, total, relative);
+    }
+}
+
+std::unique_ptr<GolfScoreFormat> golf_score_make_format(GolfScoreFormatId id)
+{
+    switch (id)
+    {
+    case GolfScoreFormatStableford:
+        return std::make_unique<StablefordFormat>();
+    case GolfScoreFormatSkins:
+        return std::make_unique<SkinsFormat>();
+    case GolfScoreFormatMatch:
+        return std::make_unique<MatchFormat>();
+    case GolfScoreFormatNassau:
+        return std::make_unique<NassauFormat>();
+    default:
+        return std::make_unique<GolfScoreFormat>();
+    }
+}
+
+const char *golf_score_format_name(GolfScoreFormatId id)
+{
+    return id < GolfScoreFormatCount ? FormatNames[id] : FormatNames[GolfScoreFormatStroke];
+}
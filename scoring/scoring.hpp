@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "round/round.hpp"
+
+typedef enum
+{
+    GolfScoreFormatStroke = 0,
+    GolfScoreFormatStableford = 1,
+    GolfScoreFormatSkins = 2,
+    GolfScoreFormatMatch = 3,  // Players paired 1v2, 3v4, ...
+    GolfScoreFormatNassau = 4, // Front, back and overall match per pair
+    GolfScoreFormatCount = 5,
+} GolfScoreFormatId;
+
+// Live standings for one scoring format. Each format keeps its own running
+// state: reset() builds it from the whole round, update() folds in a single
+// stroke change and touches at most one hole's column, so the scorecard can
+// show standings every frame without rescanning the card. The hooks default
+// to no-ops (no pure virtuals, the app links without the C++ runtime).
+class GolfScoreFormat
+{
+public:
+    virtual ~GolfScoreFormat() = default;
+
+    // After the round is resized, cleared, reloaded or its pars change
+    virtual void reset(const GolfScoreRound &) {}
+    // After player's strokes on hole changed from previous; O(players)
+    virtual void update(const GolfScoreRound &, uint8_t /*player*/, uint8_t /*hole*/, uint8_t /*previous*/) {}
+    // Short text for the scorecard line, e.g. "Pts 14" or "2 UP"
+    virtual void standing(const GolfScoreRound &round, uint8_t player, char *out, size_t size) const;
+};
+
+std::unique_ptr<GolfScoreFormat> golf_score_make_format(GolfScoreFormatId id);
+const char *golf_score_format_name(GolfScoreFormatId id);
@@ -1,10 +1,13 @@
 #include "settings.hpp"
 #include "app.hpp"
+#include "debug/memory_probe.hpp"
+#include "debug/trace.hpp"
+#include "debug/latency.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <memory>
-#include <furi/core/string.h>
 
 GolfScoreSettings::GolfScoreSettings(ViewDispatcher **view_dispatcher, void *appContext) : appContext(appContext), view_dispatcher_ref(view_dispatcher)
 {
@@ -14,8 +17,9 @@ GolfScoreSettings::GolfScoreSettings(ViewDispatcher **view_dispatcher, void *app
         return;
     }
 
-    variable_item_player_count = variable_item_list_add(variable_item_list, "Players", 1, nullptr, nullptr);
+    variable_item_player_count = variable_item_list_add(variable_item_list, "Players", GolfScoreMaxPlayers, playerCountChangedCallback, this);
     variable_item_hole_count = variable_item_list_add(variable_item_list, "Holes", 1, nullptr, nullptr);
+    variable_item_format = variable_item_list_add(variable_item_list, "Format", GolfScoreFormatCount, formatChangedCallback, this);
     variable_item_reset = variable_item_list_add(variable_item_list, "Reset Round", 1, nullptr, nullptr);
     variable_item_par_overview = variable_item_list_add(variable_item_list, "Hole Pars", 1, nullptr, nullptr);
     variable_item_load_course = variable_item_list_add(variable_item_list, "Load Course", 1, nullptr, nullptr);
@@ -25,12 +29,15 @@ GolfScoreSettings::GolfScoreSettings(ViewDispatcher **view_dispatcher, void *app
     variable_item_view_history = variable_item_list_add(variable_item_list, "View History", 1, nullptr, nullptr);
     variable_item_clear_history = variable_item_list_add(variable_item_list, "Clear History", 1, nullptr, nullptr);
 
-    for (uint8_t i = 0; i < GolfScoreMaxPlayers; ++i)
-    {
-        char label[24];
-        snprintf(label, sizeof(label), "Player %u Name", static_cast<unsigned>(i + 1));
-        variable_item_player_names[i] = variable_item_list_add(variable_item_list, label, 1, nullptr, nullptr);
-    }
+    // One entry for every player: Left/Right picks the player, OK renames them
+    variable_item_player_name = variable_item_list_add(variable_item_list, "Edit Name", 1, playerSelectorChangedCallback, this);
+    // Course handicap of the player picked above: Left/Right change it, OK moves to the next player
+    variable_item_handicap = variable_item_list_add(variable_item_list, "Handicap", HandicapOptionCount, handicapChangedCallback, this);
+    variable_item_teams = variable_item_list_add(variable_item_list, "Teams", GolfScoreTeamsModeCount, teamModeChangedCallback, this);
+    // Team of the player picked above, "-" for none
+    variable_item_team = variable_item_list_add(variable_item_list, "Team", GolfScoreMaxTeams + 1, teamChangedCallback, this);
+    // Storage latency histograms to latency.csv, for comparing SD cards
+    variable_item_export_timings = variable_item_list_add(variable_item_list, "Export Timings", 1, nullptr, nullptr);
 
     refreshValueTexts();
 }
@@ -53,22 +60,12 @@ GolfScoreSettings::~GolfScoreSettings()
         par_variable_item_list = nullptr;
     }
 
-    if (course_variable_item_list && view_dispatcher_ref && *view_dispatcher_ref)
-    {
-        view_dispatcher_remove_view(*view_dispatcher_ref, GolfScoreViewCourseList);
-        variable_item_list_free(course_variable_item_list);
-        course_variable_item_list = nullptr;
-    }
-
-    if (history_widget && view_dispatcher_ref && *view_dispatcher_ref)
-    {
-        view_dispatcher_remove_view(*view_dispatcher_ref, GolfScoreViewHistory);
-        widget_free(history_widget);
-        history_widget = nullptr;
-    }
+    course_list.reset();
+    history.reset();
 
     variable_item_player_count = nullptr;
     variable_item_hole_count = nullptr;
+    variable_item_format = nullptr;
     variable_item_reset = nullptr;
     variable_item_par_overview = nullptr;
     variable_item_load_course = nullptr;
@@ -77,8 +74,11 @@ GolfScoreSettings::~GolfScoreSettings()
     variable_item_save_round = nullptr;
     variable_item_view_history = nullptr;
     variable_item_clear_history = nullptr;
-    variable_item_player_names.fill(nullptr);
-    course_items.fill(nullptr);
+    variable_item_player_name = nullptr;
+    variable_item_handicap = nullptr;
+    variable_item_teams = nullptr;
+    variable_item_team = nullptr;
+    variable_item_export_timings = nullptr;
     par_item_hole_selector = nullptr;
     par_item_value = nullptr;
     par_hole_label.fill('\0');
@@ -86,7 +86,7 @@ GolfScoreSettings::~GolfScoreSettings()
     par_summary_text.fill('\0');
     selected_par_hole = 0;
     course_selection_mode = CourseSelectionMode::Load;
-    pending_course_slot = 0;
+    pending_course_id = GolfScoreCourseDb::InvalidId;
 }
 
 uint32_t GolfScoreSettings::callbackToSettings(void *context)
@@ -148,9 +148,9 @@ bool GolfScoreSettings::initTextInput(uint32_t view)
         return false;
     }
 
-    if (view >= SettingsViewPlayerName1 && view <= SettingsViewPlayerName4)
+    if (view == SettingsViewPlayerName && selected_player < app->getPlayerCount())
     {
-        uint8_t playerIndex = static_cast<uint8_t>(view - SettingsViewPlayerName1);
+        uint8_t playerIndex = selected_player;
         const char *current = app->getPlayerName(playerIndex);
         if (current)
         {
@@ -158,45 +158,14 @@ bool GolfScoreSettings::initTextInput(uint32_t view)
             text_input_temp_buffer[text_input_buffer_size - 1] = '\0';
         }
 
-        char header[24];
-        snprintf(header, sizeof(header), "Player %u Name", static_cast<unsigned>(playerIndex + 1));
+        snprintf(text_input_header, sizeof(text_input_header), "Player %u Name", static_cast<unsigned>(playerIndex + 1));
 
 #ifndef FW_ORIGIN_Momentum
-        switch (playerIndex)
-        {
-        case 0:
-            return easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                                    textUpdatedPlayer0Callback, callbackToSettings, view_dispatcher_ref, this);
-        case 1:
-            return easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                                    textUpdatedPlayer1Callback, callbackToSettings, view_dispatcher_ref, this);
-        case 2:
-            return easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                                    textUpdatedPlayer2Callback, callbackToSettings, view_dispatcher_ref, this);
-        case 3:
-            return easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                                    textUpdatedPlayer3Callback, callbackToSettings, view_dispatcher_ref, this);
-        default:
-            break;
-        }
+        return easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, text_input_header, text_input_temp_buffer.get(), text_input_buffer_size,
+                                                textUpdatedPlayerCallback, callbackToSettings, view_dispatcher_ref, this);
 #else
-        switch (playerIndex)
-        {
-        case 0:
-            return easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                               textUpdatedPlayer0Callback, callbackToSettings, view_dispatcher_ref, this);
-        case 1:
-            return easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                               textUpdatedPlayer1Callback, callbackToSettings, view_dispatcher_ref, this);
-        case 2:
-            return easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                               textUpdatedPlayer2Callback, callbackToSettings, view_dispatcher_ref, this);
-        case 3:
-            return easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
-                                               textUpdatedPlayer3Callback, callbackToSettings, view_dispatcher_ref, this);
-        default:
-            break;
-        }
+        return easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, text_input_header, text_input_temp_buffer.get(), text_input_buffer_size,
+                                           textUpdatedPlayerCallback, callbackToSettings, view_dispatcher_ref, this);
 #endif
     }
 
@@ -221,6 +190,10 @@ void GolfScoreSettings::settingsItemSelected(uint32_t index)
         app->toggleHoleCount();
         refreshValueTexts();
         break;
+    case SettingsViewFormat:
+        app->setFormat(static_cast<GolfScoreFormatId>((app->getFormat() + 1) % GolfScoreFormatCount));
+        refreshValueTexts();
+        break;
     case SettingsViewReset:
         app->resetScores();
         easy_flipper_dialog("Scores Reset", "All player strokes cleared.");
@@ -232,7 +205,7 @@ void GolfScoreSettings::settingsItemSelected(uint32_t index)
             if (ensureParList())
             {
                 refreshParValues();
-                view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewParSettings);
+                golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewParSettings);
             }
         }
         break;
@@ -262,14 +235,30 @@ void GolfScoreSettings::settingsItemSelected(uint32_t index)
         break;
     case SettingsViewClearHistory:
         clearHistory();
-        updateCourseListDisplay();
         break;
-    case SettingsViewPlayerName1:
-    case SettingsViewPlayerName2:
-    case SettingsViewPlayerName3:
-    case SettingsViewPlayerName4:
+    case SettingsViewPlayerName:
         startTextInput(index);
         break;
+    case SettingsViewExportTimings:
+        // Saved first so the histograms survive even if the app never exits cleanly
+        if (golf_score_latency_save() && golf_score_latency_export_csv())
+        {
+            easy_flipper_dialog("Timings Saved", "Written to latency.csv.");
+        }
+        else
+        {
+            easy_flipper_dialog("Export Failed", "Could not write timings.");
+        }
+        break;
+    case SettingsViewTeams:
+        app->setTeamMode(static_cast<GolfScoreTeamMode>((app->getTeamMode() + 1) % GolfScoreTeamsModeCount));
+        refreshValueTexts();
+        break;
+    case SettingsViewHandicap:
+    case SettingsViewTeam:
+        selected_player = static_cast<uint8_t>((selected_player + 1) % std::max<uint8_t>(1, app->getPlayerCount()));
+        updatePlayerNameItem();
+        break;
     default:
         break;
     }
@@ -286,6 +275,7 @@ void GolfScoreSettings::settingsItemSelectedCallback(void *context, uint32_t ind
 
 bool GolfScoreSettings::startTextInput(uint32_t view)
 {
+    GOLF_SCORE_MEMORY_PROBE("text_input");
     freeTextInput();
     if (!initTextInput(view))
     {
@@ -294,7 +284,7 @@ bool GolfScoreSettings::startTextInput(uint32_t view)
 
     if (view_dispatcher_ref && *view_dispatcher_ref)
     {
-        view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewTextInput);
+        golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewTextInput);
         return true;
     }
     return false;
@@ -302,6 +292,7 @@ bool GolfScoreSettings::startTextInput(uint32_t view)
 
 void GolfScoreSettings::textUpdated(uint32_t view)
 {
+    GOLF_SCORE_MEMORY_PROBE("text_input_done");
     GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
     if (!app)
     {
@@ -318,15 +309,9 @@ void GolfScoreSettings::textUpdated(uint32_t view)
 
     switch (view)
     {
-    case SettingsViewPlayerName1:
-    case SettingsViewPlayerName2:
-    case SettingsViewPlayerName3:
-    case SettingsViewPlayerName4:
-    {
-        uint8_t playerIndex = static_cast<uint8_t>(view - SettingsViewPlayerName1);
-        app->setPlayerName(playerIndex, text_input_buffer.get());
+    case SettingsViewPlayerName:
+        app->setPlayerName(selected_player, text_input_buffer.get());
         break;
-    }
     default:
         break;
     }
@@ -335,7 +320,7 @@ void GolfScoreSettings::textUpdated(uint32_t view)
 
     if (view_dispatcher_ref && *view_dispatcher_ref)
     {
-        view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewSettings);
+        golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewSettings);
     }
 }
 
@@ -352,6 +337,7 @@ void GolfScoreSettings::refreshValueTexts()
     if (variable_item_player_count)
     {
         snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned>(app->getPlayerCount()));
+        variable_item_set_current_value_index(variable_item_player_count, static_cast<uint8_t>(app->getPlayerCount() - 1));
         variable_item_set_current_value_text(variable_item_player_count, buffer);
     }
 
@@ -361,6 +347,19 @@ void GolfScoreSettings::refreshValueTexts()
         variable_item_set_current_value_text(variable_item_hole_count, buffer);
     }
 
+    if (variable_item_format)
+    {
+        variable_item_set_current_value_index(variable_item_format, app->getFormat());
+        variable_item_set_current_value_text(variable_item_format, golf_score_format_name(app->getFormat()));
+    }
+
+    if (variable_item_teams)
+    {
+        static const char *const TeamModeNames[GolfScoreTeamsModeCount] = {"Off", "Best ball", "Aggregate"};
+        variable_item_set_current_value_index(variable_item_teams, app->getTeamMode());
+        variable_item_set_current_value_text(variable_item_teams, TeamModeNames[app->getTeamMode()]);
+    }
+
     if (variable_item_reset)
     {
         variable_item_set_current_value_text(variable_item_reset, "Select to clear");
@@ -371,10 +370,9 @@ void GolfScoreSettings::refreshValueTexts()
     if (variable_item_load_course)
     {
         char text[32];
-        uint8_t active = app->getActiveCourseIndex();
-        if (active != GolfScoreApp::InvalidCourseIndex && app->courseSlotInUse(active))
+        if (app->getActiveCourseId() != GolfScoreApp::InvalidCourseId)
         {
-            snprintf(text, sizeof(text), "%s", app->getCourseName(active));
+            snprintf(text, sizeof(text), "%s", app->getActiveCourseName());
         }
         else
         {
@@ -392,7 +390,7 @@ void GolfScoreSettings::refreshValueTexts()
 
     if (variable_item_delete_course)
     {
-        variable_item_set_current_value_text(variable_item_delete_course, "Select slot");
+        variable_item_set_current_value_text(variable_item_delete_course, "Select course");
     }
 
     if (variable_item_save_round)
@@ -412,35 +410,17 @@ void GolfScoreSettings::refreshValueTexts()
         variable_item_set_current_value_text(variable_item_clear_history, "Delete log");
     }
 
-    for (uint8_t i = 0; i < GolfScoreMaxPlayers; ++i)
+    if (variable_item_export_timings)
     {
-        if (!variable_item_player_names[i])
-        {
-            continue;
-        }
-
-        const char *name = app->getPlayerName(i);
-        if (i < app->getPlayerCount())
-        {
-            variable_item_set_current_value_text(variable_item_player_names[i], name);
-        }
-        else
-        {
-            char inactive[32];
-            snprintf(inactive, sizeof(inactive), "%s (off)", name);
-            variable_item_set_current_value_text(variable_item_player_names[i], inactive);
-        }
+        variable_item_set_current_value_text(variable_item_export_timings, "To CSV");
     }
 
+    updatePlayerNameItem();
+
     if (par_variable_item_list)
     {
         refreshParValues();
     }
-
-    if (course_variable_item_list)
-    {
-        updateCourseListDisplay();
-    }
 }
 
 void GolfScoreSettings::refreshParValues()
@@ -473,36 +453,13 @@ bool GolfScoreSettings::ensureParList()
 
     par_item_hole_selector = variable_item_list_add(par_variable_item_list, "Hole", 1, parHoleSelectorChangedCallback, &par_hole_context);
     par_item_value = variable_item_list_add(par_variable_item_list, "Par", HoleParOptionCount, parValueChangedCallback, &par_value_context);
+    par_item_stroke_index = variable_item_list_add(par_variable_item_list, "Stroke Index", 1, strokeIndexChangedCallback, this);
 
     updateParEditorDisplay();
 
     return true;
 }
 
-bool GolfScoreSettings::ensureCourseList()
-{
-    if (course_variable_item_list)
-    {
-        return true;
-    }
-
-    if (!easy_flipper_set_variable_item_list(&course_variable_item_list, GolfScoreViewCourseList,
-                                             courseItemSelectedCallback, callbackToSettings, view_dispatcher_ref, this))
-    {
-        return false;
-    }
-
-    for (uint8_t i = 0; i < GolfScoreMaxCourses; ++i)
-    {
-        char label[24];
-        snprintf(label, sizeof(label), "Slot %u", static_cast<unsigned>(i + 1));
-        course_items[i] = variable_item_list_add(course_variable_item_list, label, 1, nullptr, nullptr);
-    }
-
-    updateCourseListDisplay();
-    return true;
-}
-
 void GolfScoreSettings::updateParSummary()
 {
     if (!variable_item_par_overview)
@@ -530,153 +487,195 @@ void GolfScoreSettings::startCourseSelection(CourseSelectionMode mode)
     }
 
     course_selection_mode = mode;
-    pending_course_slot = 0;
+    pending_course_id = GolfScoreCourseDb::InvalidId;
 
-    if (!ensureCourseList())
+    if (!course_list)
     {
-        return;
+        course_list = std::make_unique<GolfScoreCourseList>(view_dispatcher_ref);
     }
 
-    updateCourseListDisplay();
-    view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewCourseList);
+    const char *title = mode == CourseSelectionMode::Load ? "Load" : mode == CourseSelectionMode::Save ? "Save" : "Delete";
+    if (!course_list->show(title, mode == CourseSelectionMode::Save, courseSelectedCallback, courseSearchCallback, this))
+    {
+        easy_flipper_dialog("Error", "Could not open course list.");
+    }
 }
 
-void GolfScoreSettings::updateCourseListDisplay()
+void GolfScoreSettings::showHistory()
 {
-    GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
-    if (!app)
+    if (!view_dispatcher_ref || !*view_dispatcher_ref)
     {
         return;
     }
 
-    for (uint8_t i = 0; i < GolfScoreMaxCourses; ++i)
+    if (!history)
     {
-        if (!course_items[i])
-        {
-            continue;
-        }
-
-        char text[32];
-        if (app->courseSlotInUse(i))
-        {
-            const char *name = app->getCourseName(i);
-            uint8_t holes = app->getCourseHoleCount(i);
-            snprintf(text, sizeof(text), "%s (%u)", name, static_cast<unsigned>(holes));
-        }
-        else
-        {
-            snprintf(text, sizeof(text), "Empty");
-        }
+        history = std::make_unique<GolfScoreHistory>(view_dispatcher_ref);
+    }
 
-        variable_item_set_current_value_text(course_items[i], text);
+    if (!history->show())
+    {
+        easy_flipper_dialog("History", "Unable to open history view.");
     }
 }
 
-bool GolfScoreSettings::ensureHistoryWidget()
+void GolfScoreSettings::clearHistory()
 {
-    if (history_widget)
+    GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
+    if (!app)
     {
-        return true;
+        return;
     }
 
-    return easy_flipper_set_widget(&history_widget, GolfScoreViewHistory, nullptr, callbackToSettings, view_dispatcher_ref);
+    if (app->clearRoundHistory())
+    {
+        easy_flipper_dialog("Round History", "History cleared.");
+    }
+    else
+    {
+        easy_flipper_dialog("Round History", "Failed to clear history.");
+    }
 }
 
-void GolfScoreSettings::showHistory()
+void GolfScoreSettings::textUpdatedPlayerCallback(void *context)
 {
-    if (!view_dispatcher_ref || !*view_dispatcher_ref)
+    auto *settings = static_cast<GolfScoreSettings *>(context);
+    if (settings)
     {
-        return;
+        settings->textUpdated(SettingsViewPlayerName);
     }
+}
 
-    if (!ensureHistoryWidget())
+void GolfScoreSettings::playerCountChangedCallback(VariableItem *item)
+{
+    auto *settings = static_cast<GolfScoreSettings *>(variable_item_get_context(item));
+    GolfScoreApp *app = settings ? static_cast<GolfScoreApp *>(settings->appContext) : nullptr;
+    if (!app)
     {
-        easy_flipper_dialog("History", "Unable to open history view.");
         return;
     }
 
-    GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
+    app->setPlayerCount(static_cast<uint8_t>(variable_item_get_current_value_index(item) + 1));
+    settings->refreshValueTexts();
+}
+
+void GolfScoreSettings::formatChangedCallback(VariableItem *item)
+{
+    auto *settings = static_cast<GolfScoreSettings *>(variable_item_get_context(item));
+    GolfScoreApp *app = settings ? static_cast<GolfScoreApp *>(settings->appContext) : nullptr;
     if (!app)
     {
         return;
     }
 
-    FuriString *history = furi_string_alloc();
-    bool has_history = app->readRoundHistory(history);
-
-    widget_reset(history_widget);
+    app->setFormat(static_cast<GolfScoreFormatId>(variable_item_get_current_value_index(item)));
+    settings->refreshValueTexts();
+}
 
-    if (has_history)
-    {
-        widget_add_text_scroll_element(history_widget, 0, 0, 128, 64, furi_string_get_cstr(history));
-    }
-    else
+void GolfScoreSettings::playerSelectorChangedCallback(VariableItem *item)
+{
+    auto *settings = static_cast<GolfScoreSettings *>(variable_item_get_context(item));
+    if (!settings)
     {
-        widget_add_text_scroll_element(history_widget, 0, 0, 128, 64, "No saved rounds yet.");
+        return;
     }
 
-    furi_string_free(history);
-
-    view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewHistory);
+    settings->selected_player = variable_item_get_current_value_index(item);
+    settings->updatePlayerNameItem();
 }
 
-void GolfScoreSettings::clearHistory()
+void GolfScoreSettings::updatePlayerNameItem()
 {
     GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
-    if (!app)
+    if (!app || !variable_item_player_name)
     {
         return;
     }
 
-    if (app->clearRoundHistory())
+    uint8_t count = std::max<uint8_t>(1, app->getPlayerCount());
+    if (selected_player >= count)
     {
-        easy_flipper_dialog("Round History", "History cleared.");
-        if (history_widget)
-        {
-            widget_reset(history_widget);
-            widget_add_text_scroll_element(history_widget, 0, 0, 128, 64, "No saved rounds yet.");
-        }
+        selected_player = static_cast<uint8_t>(count - 1);
     }
-    else
+
+    variable_item_set_values_count(variable_item_player_name, count);
+    variable_item_set_current_value_index(variable_item_player_name, selected_player);
+    snprintf(player_name_label.data(), player_name_label.size(), "%u: %s", static_cast<unsigned>(selected_player + 1), app->getPlayerName(selected_player));
+    variable_item_set_current_value_text(variable_item_player_name, player_name_label.data());
+    updateHandicapItem();
+    updateTeamItem();
+}
+
+void GolfScoreSettings::updateHandicapItem()
+{
+    GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
+    if (!app || !variable_item_handicap)
     {
-        easy_flipper_dialog("Round History", "Failed to clear history.");
+        return;
     }
+
+    // Plus handicaps are written with a leading '+', as on a handicap card
+    int8_t handicap = app->getHandicap(selected_player);
+    variable_item_set_current_value_index(variable_item_handicap, static_cast<uint8_t>(handicap - GolfScoreMinHandicap));
+    snprintf(handicap_label.data(), handicap_label.size(), handicap < 0 ? "%u: +%d" : "%u: %d", static_cast<unsigned>(selected_player + 1), handicap < 0 ? -handicap : handicap);
+    variable_item_set_current_value_text(variable_item_handicap, handicap_label.data());
 }
 
-void GolfScoreSettings::textUpdatedPlayer0Callback(void *context)
+void GolfScoreSettings::handicapChangedCallback(VariableItem *item)
 {
-    auto *settings = static_cast<GolfScoreSettings *>(context);
-    if (settings)
+    auto *settings = static_cast<GolfScoreSettings *>(variable_item_get_context(item));
+    GolfScoreApp *app = settings ? static_cast<GolfScoreApp *>(settings->appContext) : nullptr;
+    if (!app)
     {
-        settings->textUpdated(SettingsViewPlayerName1);
+        return;
     }
+
+    int handicap = GolfScoreMinHandicap + variable_item_get_current_value_index(item);
+    app->setHandicap(settings->selected_player, static_cast<int8_t>(handicap));
+    settings->updateHandicapItem();
 }
 
-void GolfScoreSettings::textUpdatedPlayer1Callback(void *context)
+void GolfScoreSettings::updateTeamItem()
 {
-    auto *settings = static_cast<GolfScoreSettings *>(context);
-    if (settings)
+    GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
+    if (!app || !variable_item_team)
     {
-        settings->textUpdated(SettingsViewPlayerName2);
+        return;
     }
+
+    // Index 0 is no team, then A, B, ...
+    uint8_t team = app->getTeam(selected_player);
+    bool member = team < GolfScoreMaxTeams;
+    variable_item_set_current_value_index(variable_item_team, member ? static_cast<uint8_t>(team + 1) : 0);
+    snprintf(team_label.data(), team_label.size(), "%u: %c", static_cast<unsigned>(selected_player + 1), member ? GolfScoreTeams::letter(team) : '-');
+    variable_item_set_current_value_text(variable_item_team, team_label.data());
 }
 
-void GolfScoreSettings::textUpdatedPlayer2Callback(void *context)
+void GolfScoreSettings::teamModeChangedCallback(VariableItem *item)
 {
-    auto *settings = static_cast<GolfScoreSettings *>(context);
-    if (settings)
+    auto *settings = static_cast<GolfScoreSettings *>(variable_item_get_context(item));
+    GolfScoreApp *app = settings ? static_cast<GolfScoreApp *>(settings->appContext) : nullptr;
+    if (!app)
     {
-        settings->textUpdated(SettingsViewPlayerName3);
+        return;
     }
+
+    app->setTeamMode(static_cast<GolfScoreTeamMode>(variable_item_get_current_value_index(item)));
+    settings->refreshValueTexts();
 }
 
-void GolfScoreSettings::textUpdatedPlayer3Callback(void *context)
+void GolfScoreSettings::teamChangedCallback(VariableItem *item)
 {
-    auto *settings = static_cast<GolfScoreSettings *>(context);
-    if (settings)
+    auto *settings = static_cast<GolfScoreSettings *>(variable_item_get_context(item));
+    GolfScoreApp *app = settings ? static_cast<GolfScoreApp *>(settings->appContext) : nullptr;
+    if (!app)
     {
-        settings->textUpdated(SettingsViewPlayerName4);
+        return;
     }
+
+    uint8_t index = variable_item_get_current_value_index(item);
+    app->setTeam(settings->selected_player, index == 0 ? GolfScoreNoTeam : static_cast<uint8_t>(index - 1));
+    settings->updateTeamItem();
 }
 
 void GolfScoreSettings::parHoleSelectorChangedCallback(VariableItem *item)
@@ -797,86 +796,100 @@ void GolfScoreSettings::updateParEditorDisplay()
     snprintf(par_value_label.data(), par_value_label.size(), "%u", static_cast<unsigned>(par));
     variable_item_set_current_value_text(par_item_value, par_value_label.data());
 
+    if (par_item_stroke_index)
+    {
+        uint8_t stroke_index = app->getStrokeIndex(selected_par_hole);
+        variable_item_set_values_count(par_item_stroke_index, hole_count);
+        variable_item_set_current_value_index(par_item_stroke_index, stroke_index > 0 ? static_cast<uint8_t>(stroke_index - 1) : 0);
+        snprintf(stroke_index_label.data(), stroke_index_label.size(), "%u", static_cast<unsigned>(stroke_index));
+        variable_item_set_current_value_text(par_item_stroke_index, stroke_index_label.data());
+    }
+
     suppress_par_updates = restore_flag;
 }
 
-void GolfScoreSettings::courseItemSelectedCallback(void *context, uint32_t index)
+void GolfScoreSettings::strokeIndexChangedCallback(VariableItem *item)
 {
-    auto *settings = static_cast<GolfScoreSettings *>(context);
-    if (settings)
+    auto *settings = static_cast<GolfScoreSettings *>(variable_item_get_context(item));
+    GolfScoreApp *app = settings ? static_cast<GolfScoreApp *>(settings->appContext) : nullptr;
+    if (!app || settings->suppress_par_updates)
     {
-        settings->courseItemSelected(index);
+        return;
     }
+
+    app->setStrokeIndex(settings->selected_par_hole, static_cast<uint8_t>(variable_item_get_current_value_index(item) + 1));
+    settings->updateParEditorDisplay();
 }
 
-void GolfScoreSettings::courseItemSelected(uint32_t index)
+void GolfScoreSettings::courseSelectedCallback(void *context, const GolfScoreCourseEntry *entry)
 {
-    if (index >= GolfScoreMaxCourses)
+    auto *settings = static_cast<GolfScoreSettings *>(context);
+    if (settings)
     {
-        return;
+        settings->courseSelected(entry);
     }
+}
 
+void GolfScoreSettings::courseSelected(const GolfScoreCourseEntry *entry)
+{
     GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
     if (!app)
     {
         return;
     }
 
-    pending_course_slot = static_cast<uint8_t>(index);
-
     switch (course_selection_mode)
     {
     case CourseSelectionMode::Load:
-        if (app->courseSlotInUse(pending_course_slot))
+        if (entry && app->applyCourse(entry->id))
         {
-            const char *name = app->getCourseName(pending_course_slot);
-            app->applyCoursePreset(pending_course_slot);
             updateParSummary();
             refreshParValues();
             refreshValueTexts();
-            updateCourseListDisplay();
-            easy_flipper_dialog("Course Loaded", name);
+            easy_flipper_dialog("Course Loaded", app->getActiveCourseName());
             if (view_dispatcher_ref && *view_dispatcher_ref)
             {
-                view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewSettings);
+                golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewSettings);
             }
         }
         else
         {
-            easy_flipper_dialog("Empty Slot", "No course saved in this slot.");
+            easy_flipper_dialog("Load Failed", "Could not read course.");
         }
         break;
     case CourseSelectionMode::Save:
-        if (!startCourseNameInput(pending_course_slot))
+        if (!startCourseNameInput(entry))
         {
             easy_flipper_dialog("Save Failed", "Unable to start name input.");
             if (view_dispatcher_ref && *view_dispatcher_ref)
             {
-                view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewCourseList);
+                golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewCourseList);
             }
         }
         break;
     case CourseSelectionMode::Delete:
-        if (app->courseSlotInUse(pending_course_slot))
+        if (entry)
         {
             char name_copy[32];
-            const char *name = app->getCourseName(pending_course_slot);
-            snprintf(name_copy, sizeof(name_copy), "%s", name);
-            app->deleteCoursePreset(pending_course_slot);
-            updateCourseListDisplay();
-            refreshValueTexts();
-            easy_flipper_dialog("Course Deleted", name_copy);
-        }
-        else
-        {
-            easy_flipper_dialog("Empty Slot", "Nothing to remove.");
+            snprintf(name_copy, sizeof(name_copy), "%s", entry->name.data());
+            if (app->deleteCourse(entry->id))
+            {
+                course_list->refresh();
+                refreshValueTexts();
+                easy_flipper_dialog("Course Deleted", name_copy);
+            }
+            else
+            {
+                easy_flipper_dialog("Delete Failed", "Could not remove course.");
+            }
         }
         break;
     }
 }
 
-bool GolfScoreSettings::startCourseNameInput(uint8_t slot)
+bool GolfScoreSettings::startCourseNameInput(const GolfScoreCourseEntry *entry)
 {
+    GOLF_SCORE_MEMORY_PROBE("text_input");
     GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
     if (!app)
     {
@@ -888,7 +901,7 @@ bool GolfScoreSettings::startCourseNameInput(uint8_t slot)
         freeTextInput();
     }
 
-    pending_course_slot = slot;
+    pending_course_id = entry ? entry->id : GolfScoreCourseDb::InvalidId;
 
     text_input_buffer = std::make_unique<char[]>(text_input_buffer_size);
     text_input_temp_buffer = std::make_unique<char[]>(text_input_buffer_size);
@@ -901,28 +914,20 @@ bool GolfScoreSettings::startCourseNameInput(uint8_t slot)
     std::memset(text_input_buffer.get(), 0, text_input_buffer_size);
     std::memset(text_input_temp_buffer.get(), 0, text_input_buffer_size);
 
-    if (app->courseSlotInUse(slot))
-    {
-        const char *existing = app->getCourseName(slot);
-        if (existing && existing[0] != '\0')
-        {
-            strncpy(text_input_temp_buffer.get(), existing, text_input_buffer_size - 1);
-            text_input_temp_buffer[text_input_buffer_size - 1] = '\0';
-        }
-    }
-    else
+    // Overwriting keeps the old name; a new course starts from the loaded one
+    const char *existing = entry ? entry->name.data() : app->getActiveCourseName();
+    if (existing && existing[0] != '\0')
     {
-        snprintf(text_input_temp_buffer.get(), text_input_buffer_size, "Course %u", static_cast<unsigned>(slot + 1));
+        snprintf(text_input_temp_buffer.get(), std::min<size_t>(text_input_buffer_size, GolfScoreCourseNameLength), "%s", existing);
     }
 
-    char header[24];
-    snprintf(header, sizeof(header), "Save Slot %u", static_cast<unsigned>(slot + 1));
+    const char *header = entry ? "Overwrite Course" : "New Course";
 
 #ifndef FW_ORIGIN_Momentum
-    bool ok = easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
+    bool ok = easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), GolfScoreCourseNameLength,
                                                textUpdatedCourseCallback, callbackToCourseList, view_dispatcher_ref, this);
 #else
-    bool ok = easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), text_input_buffer_size,
+    bool ok = easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, header, text_input_temp_buffer.get(), GolfScoreCourseNameLength,
                                           textUpdatedCourseCallback, callbackToCourseList, view_dispatcher_ref, this);
 #endif
 
@@ -934,7 +939,7 @@ bool GolfScoreSettings::startCourseNameInput(uint8_t slot)
 
     if (view_dispatcher_ref && *view_dispatcher_ref)
     {
-        view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewTextInput);
+        golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewTextInput);
         return true;
     }
 
@@ -952,6 +957,7 @@ void GolfScoreSettings::textUpdatedCourseCallback(void *context)
 
 void GolfScoreSettings::textUpdatedCourseName()
 {
+    GOLF_SCORE_MEMORY_PROBE("text_input_done");
     GolfScoreApp *app = static_cast<GolfScoreApp *>(appContext);
     if (!app)
     {
@@ -967,24 +973,136 @@ void GolfScoreSettings::textUpdatedCourseName()
     text_input_buffer[text_input_buffer_size - 1] = '\0';
 
     const char *name = text_input_buffer.get();
-    if (!app->saveCoursePreset(pending_course_slot, name))
+    if (app->saveCourse(pending_course_id, name) == GolfScoreApp::InvalidCourseId)
     {
         easy_flipper_dialog("Save Failed", "Could not save course.");
     }
     else
     {
-        easy_flipper_dialog("Course Saved", app->getCourseName(pending_course_slot));
+        easy_flipper_dialog("Course Saved", app->getActiveCourseName());
     }
 
-    updateCourseListDisplay();
+    if (course_list)
+    {
+        course_list->refresh();
+    }
     refreshValueTexts();
 
     if (view_dispatcher_ref && *view_dispatcher_ref)
     {
-        view_dispatcher_switch_to_view(*view_dispatcher_ref, GolfScoreViewCourseList);
+        golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewCourseList);
+    }
+}
+
+void GolfScoreSettings::courseSearchCallback(void *context)
+{
+    auto *settings = static_cast<GolfScoreSettings *>(context);
+    if (settings && !settings->startCourseSearch())
+    {
+        easy_flipper_dialog("Error", "Unable to start search input.");
     }
 }
 
+bool GolfScoreSettings::startCourseSearch()
+{
+    GOLF_SCORE_MEMORY_PROBE("text_input");
+    if (!course_list)
+    {
+        return false;
+    }
+
+    if (text_input_buffer || text_input_temp_buffer)
+    {
+        freeTextInput();
+    }
+
+    text_input_buffer = std::make_unique<char[]>(text_input_buffer_size);
+    text_input_temp_buffer = std::make_unique<char[]>(text_input_buffer_size);
+
+    if (!text_input_buffer || !text_input_temp_buffer)
+    {
+        return false;
+    }
+
+    std::memset(text_input_buffer.get(), 0, text_input_buffer_size);
+    std::memset(text_input_temp_buffer.get(), 0, text_input_buffer_size);
+    snprintf(text_input_temp_buffer.get(), GolfScoreCourseNameLength, "%s", course_list->getPrefix());
+    snprintf(course_search_header.data(), course_search_header.size(), "Name starts with");
+
+#ifndef FW_ORIGIN_Momentum
+    bool ok = easy_flipper_set_uart_text_input(&text_input, GolfScoreViewTextInput, course_search_header.data(), text_input_temp_buffer.get(), GolfScoreCourseNameLength,
+                                               textUpdatedCourseSearchCallback, callbackToCourseList, view_dispatcher_ref, this);
+    if (ok)
+    {
+        // Narrow the list on every keystroke; Back keeps the current filter
+        uart_text_input_set_changed_callback(text_input, textChangedCourseSearchCallback, this);
+    }
+#else
+    // The firmware text input has no edit hook, so the filter applies on Save
+    bool ok = easy_flipper_set_text_input(&text_input, GolfScoreViewTextInput, course_search_header.data(), text_input_temp_buffer.get(), GolfScoreCourseNameLength,
+                                          textUpdatedCourseSearchCallback, callbackToCourseList, view_dispatcher_ref, this);
+#endif
+
+    if (!ok)
+    {
+        freeTextInput();
+        return false;
+    }
+
+    if (view_dispatcher_ref && *view_dispatcher_ref)
+    {
+        golf_score_switch_view(*view_dispatcher_ref, GolfScoreViewTextInput);
+        return true;
+    }
+
+    return false;
+}
+
+void GolfScoreSettings::textChangedCourseSearchCallback(void *context)
+{
+    auto *settings = static_cast<GolfScoreSettings *>(context);
+    if (settings)
+    {
+        settings->courseSearchChanged();
+    }
+}
+
+void GolfScoreSettings::textUpdatedCourseSearchCallback(void *context)
+{
+    auto *settings = static_cast<GolfScoreSettings *>(context);
+    if (settings && settings->course_list)
+    {
+        settings->course_list->setPrefix(settings->text_input_temp_buffer.get());
+        settings->course_list->reopen();
+    }
+}
+
+void GolfScoreSettings::courseSearchChanged()
+{
+    if (!course_list || !text_input_temp_buffer)
+    {
+        return;
+    }
+
+    uint32_t matches = course_list->setPrefix(text_input_temp_buffer.get());
+    GolfScoreCourseEntry first;
+    if (text_input_temp_buffer[0] == '\0')
+    {
+        snprintf(course_search_header.data(), course_search_header.size(), "Name starts with");
+    }
+    else if (matches == 0 || !course_list->firstMatch(first))
+    {
+        snprintf(course_search_header.data(), course_search_header.size(), "No match");
+    }
+    else
+    {
+        snprintf(course_search_header.data(), course_search_header.size(), "%lu: %s", static_cast<unsigned long>(matches), first.name.data());
+    }
+
+#ifndef FW_ORIGIN_Momentum
+    uart_text_input_set_header_text(text_input, course_search_header.data());
+#endif
+}
 
 uint8_t GolfScoreSettings::parToIndex(uint8_t par) const
 {
@@ -5,6 +5,8 @@
 
 #include "easy_flipper/easy_flipper.h"
 #include "golf_score_config.hpp"
+#include "courses/course_list.hpp"
+#include "history/history.hpp"
 
 class GolfScoreApp;
 
@@ -12,18 +14,20 @@ typedef enum
 {
     SettingsViewPlayers = 0,
     SettingsViewHoles = 1,
-    SettingsViewReset = 2,
-    SettingsViewPars = 3,
-    SettingsViewLoadCourse = 4,
-    SettingsViewSaveCourse = 5,
-    SettingsViewDeleteCourse = 6,
-    SettingsViewSaveRound = 7,
-    SettingsViewViewHistory = 8,
-    SettingsViewClearHistory = 9,
-    SettingsViewPlayerName1 = 10,
-    SettingsViewPlayerName2 = 11,
-    SettingsViewPlayerName3 = 12,
-    SettingsViewPlayerName4 = 13,
+    SettingsViewFormat = 2,
+    SettingsViewReset = 3,
+    SettingsViewPars = 4,
+    SettingsViewLoadCourse = 5,
+    SettingsViewSaveCourse = 6,
+    SettingsViewDeleteCourse = 7,
+    SettingsViewSaveRound = 8,
+    SettingsViewViewHistory = 9,
+    SettingsViewClearHistory = 10,
+    SettingsViewPlayerName = 11,
+    SettingsViewHandicap = 12,
+    SettingsViewTeams = 13,
+    SettingsViewTeam = 14,
+    SettingsViewExportTimings = 15,
 } SettingsViewChoice;
 
 class GolfScoreSettings
@@ -38,9 +42,11 @@ private:
     std::unique_ptr<char[]> text_input_buffer;
     uint32_t text_input_buffer_size = 32;
     std::unique_ptr<char[]> text_input_temp_buffer;
+    char text_input_header[24] = {}; // The text input keeps the pointer, not a copy
     VariableItemList *variable_item_list = nullptr;
     VariableItem *variable_item_player_count = nullptr;
     VariableItem *variable_item_hole_count = nullptr;
+    VariableItem *variable_item_format = nullptr;
     VariableItem *variable_item_reset = nullptr;
     VariableItem *variable_item_par_overview = nullptr;
     VariableItem *variable_item_load_course = nullptr;
@@ -49,13 +55,21 @@ private:
     VariableItem *variable_item_save_round = nullptr;
     VariableItem *variable_item_view_history = nullptr;
     VariableItem *variable_item_clear_history = nullptr;
+    VariableItem *variable_item_export_timings = nullptr;
     VariableItemList *par_variable_item_list = nullptr;
     VariableItem *par_item_hole_selector = nullptr;
     VariableItem *par_item_value = nullptr;
-    VariableItemList *course_variable_item_list = nullptr;
-    Widget *history_widget = nullptr;
-    std::array<VariableItem *, GolfScoreMaxPlayers> variable_item_player_names{};
-    std::array<VariableItem *, GolfScoreMaxCourses> course_items{};
+    VariableItem *par_item_stroke_index = nullptr;
+    std::unique_ptr<GolfScoreCourseList> course_list;
+    std::unique_ptr<GolfScoreHistory> history;
+    VariableItem *variable_item_player_name = nullptr;
+    VariableItem *variable_item_handicap = nullptr;
+    VariableItem *variable_item_teams = nullptr;
+    VariableItem *variable_item_team = nullptr;
+    uint8_t selected_player = 0;
+    std::array<char, 24> player_name_label{};
+    std::array<char, 16> handicap_label{};
+    std::array<char, 8> team_label{};
     struct ParItemContext
     {
         GolfScoreSettings *settings = nullptr;
@@ -64,8 +78,10 @@ private:
     uint8_t selected_par_hole = 0;
     std::array<char, 24> par_hole_label{};
     std::array<char, 24> par_value_label{};
+    std::array<char, 8> stroke_index_label{};
     std::array<char, 32> par_summary_text{};
     static constexpr uint8_t HoleParOptionCount = GolfScoreMaxPar - GolfScoreMinPar + 1;
+    static constexpr uint8_t HandicapOptionCount = GolfScoreMaxHandicap - GolfScoreMinHandicap + 1;
     bool suppress_par_updates = false;
     enum class CourseSelectionMode
     {
@@ -74,7 +90,8 @@ private:
         Delete,
     };
     CourseSelectionMode course_selection_mode = CourseSelectionMode::Load;
-    uint8_t pending_course_slot = 0;
+    uint16_t pending_course_id = GolfScoreCourseDb::InvalidId;
+    std::array<char, 32> course_search_header{};
     ViewDispatcher **view_dispatcher_ref;
 
     static uint32_t callbackToSubmenu(void *context);
@@ -88,26 +105,35 @@ private:
     void refreshValueTexts();
     void refreshParValues();
     bool ensureParList();
-    bool ensureCourseList();
     void startCourseSelection(CourseSelectionMode mode);
-    void updateCourseListDisplay();
-    bool ensureHistoryWidget();
     void showHistory();
     void clearHistory();
-    static void textUpdatedPlayer0Callback(void *context);
-    static void textUpdatedPlayer1Callback(void *context);
-    static void textUpdatedPlayer2Callback(void *context);
-    static void textUpdatedPlayer3Callback(void *context);
+    static void textUpdatedPlayerCallback(void *context);
+    static void playerCountChangedCallback(VariableItem *item);
+    static void formatChangedCallback(VariableItem *item);
+    static void playerSelectorChangedCallback(VariableItem *item);
+    void updatePlayerNameItem();
+    static void handicapChangedCallback(VariableItem *item);
+    void updateHandicapItem();
+    static void teamModeChangedCallback(VariableItem *item);
+    static void teamChangedCallback(VariableItem *item);
+    void updateTeamItem();
+    static void strokeIndexChangedCallback(VariableItem *item);
     void updateParEditorDisplay();
     static void parHoleSelectorChangedCallback(VariableItem *item);
     static void parValueChangedCallback(VariableItem *item);
     void parHoleSelectorChanged(VariableItem *item);
     void parValueChanged(VariableItem *item);
-    static void courseItemSelectedCallback(void *context, uint32_t index);
-    void courseItemSelected(uint32_t index);
-    bool startCourseNameInput(uint8_t slot);
+    static void courseSelectedCallback(void *context, const GolfScoreCourseEntry *entry);
+    void courseSelected(const GolfScoreCourseEntry *entry);
+    bool startCourseNameInput(const GolfScoreCourseEntry *entry);
     static void textUpdatedCourseCallback(void *context);
     void textUpdatedCourseName();
+    static void courseSearchCallback(void *context);
+    bool startCourseSearch();
+    static void textChangedCourseSearchCallback(void *context);
+    static void textUpdatedCourseSearchCallback(void *context);
+    void courseSearchChanged();
     void updateParSummary();
     uint8_t parToIndex(uint8_t par) const;
     uint8_t indexToPar(uint8_t index) const;
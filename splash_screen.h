@@ -1,95 +1,113 @@
 #pragma once
 
-#include <stdint.h>
+// Generated by tools/splash_rle.py from assets/splash.xbm - do not edit by hand.
+// 1024 bytes raw, 695 bytes packed.
 
-static const uint8_t SplashScreenBitmap[] = {
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x60,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0xF0,     0x3F,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x3C,
-    0xE0,     0x01,     0x00,     0x00,     0x00,     0x00,     0xF0,     0x03,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x07,     0x80,     0x03,     0x00,     0x00,     0x00,     0x00,     0xF0,     0x1F,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x80,     0x01,     0x00,     0x06,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0xFC,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0xC0,     0x00,
-    0x00,     0x0C,     0x00,     0x00,     0x00,     0x00,     0x70,     0xC0,     0x07,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x60,     0x00,     0x00,     0x08,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x3F,     0x00,     0x00,     0x00,     0x00,     0x00,     0x20,     0x00,     0x00,     0x18,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0xF0,     0x01,     0x00,     0x00,     0x00,     0x00,     0x30,     0x80,
-    0x07,     0x10,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x80,     0x1F,     0x00,     0x00,
-    0x00,     0x00,     0x10,     0x80,     0x07,     0x30,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x3C,     0x00,     0x00,     0x00,     0x00,     0x18,     0x40,     0x06,     0x30,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x3E,     0x00,     0x00,     0x00,     0x00,     0x1E,     0x40,
-    0x06,     0x78,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0xC0,     0x1F,     0x00,     0x00,
-    0x00,     0xC0,     0x0F,     0x80,     0x07,     0x80,     0x01,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0xF8,     0x01,     0x00,     0x00,     0x00,     0xE0,     0x0C,     0x00,     0x01,     0x00,     0x07,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x3E,     0x00,     0x00,     0x00,     0x00,     0x30,     0x0C,     0x00,
-    0x00,     0x00,     0x04,     0x00,     0x00,     0x00,     0x70,     0xE0,     0x07,     0x00,     0x00,     0x00,
-    0x00,     0x18,     0x04,     0x00,     0x0E,     0x00,     0x04,     0x00,     0x00,     0x00,     0x70,     0xFC,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x0C,     0x04,     0x00,     0x38,     0x00,     0x06,     0x00,
-    0x00,     0x00,     0xF0,     0x1F,     0x00,     0x00,     0x00,     0x00,     0x00,     0x0C,     0x04,     0x00,
-    0xF8,     0x83,     0x07,     0x00,     0x00,     0x00,     0xF0,     0x03,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x06,     0x04,     0x00,     0x90,     0xFF,     0x01,     0x00,     0x00,     0x00,     0xF0,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x06,     0x04,     0x00,     0x30,     0x06,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x02,     0x07,     0x20,
-    0x40,     0x0E,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0xF6,     0x07,     0x60,     0x80,     0x1F,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x3E,     0x04,     0xC0,     0x10,     0x10,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x0C,     0x80,
-    0x61,     0x18,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x0C,     0x00,     0xC3,     0x0F,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x8C,     0x00,     0x46,     0x06,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x88,     0x00,
-    0x6C,     0x04,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x18,     0x01,     0x38,     0x0C,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x18,     0x03,     0x30,     0x0C,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x18,     0x06,
-    0x20,     0x0C,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x30,     0x1C,     0x60,     0x0C,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x30,     0xF0,     0xE0,     0x07,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x20,     0xC0,
-    0xFF,     0x03,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x60,     0x00,     0xFC,     0x00,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x40,     0x00,     0xC8,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0xC0,     0x00,
-    0xCC,     0x01,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x80,     0x01,     0x84,     0x03,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x01,     0x04,     0x03,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x03,
-    0x04,     0x06,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x06,     0x04,     0x0C,     0x00,     0x00,     0x00,     0x00,     0x70,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x04,     0x04,     0x0C,     0x00,     0x00,
-    0x00,     0x00,     0x70,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x0C,
-    0x04,     0x18,     0xC0,     0x01,     0x00,     0x00,     0x70,     0xFE,     0x3F,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x18,     0x1C,     0x30,     0xF0,     0x03,     0x00,     0x80,     0x77,     0x00,
-    0xF8,     0x03,     0x00,     0x00,     0x00,     0x00,     0x00,     0x1E,     0x78,     0x70,     0x18,     0x03,
-    0x00,     0xF0,     0x71,     0x00,     0x00,     0x1F,     0x00,     0x00,     0x00,     0x00,     0x00,     0x03,
-    0xC0,     0x61,     0x8C,     0x06,     0x00,     0x38,     0x70,     0x00,     0x00,     0x78,     0x00,     0x00,
-    0x00,     0x00,     0x80,     0x01,     0x00,     0xC3,     0x27,     0x06,     0x00,     0x0C,     0xFC,     0x03,
-    0x00,     0xE0,     0x00,     0x00,     0x00,     0x00,     0xC0,     0x00,     0x00,     0x82,     0x01,     0x06,
-    0x00,     0x06,     0xFF,     0x0F,     0x00,     0xC0,     0x00,     0x00,     0x00,     0x00,     0x40,     0x00,
-    0x01,     0x86,     0x03,     0x02,     0x00,     0x06,     0xFF,     0x0F,     0x00,     0x80,     0x00,     0x00,
-    0x00,     0x00,     0x60,     0x80,     0x03,     0x44,     0x04,     0x03,     0x00,     0x06,     0xFC,     0x03,
-    0x00,     0x80,     0x00,     0x00,     0x00,     0x00,     0x60,     0xE0,     0x7C,     0x24,     0xF8,     0x01,
-    0x00,     0x0E,     0x00,     0x00,     0x00,     0xC0,     0x00,     0x00,     0x00,     0x00,     0x60,     0x7C,
-    0xE0,     0x27,     0x78,     0x00,     0x00,     0x1C,     0x00,     0x00,     0x00,     0x70,     0x00,     0x00,
-    0x00,     0x00,     0x60,     0x0F,     0x00,     0x27,     0x08,     0x00,     0x00,     0xF0,     0x00,     0x00,
-    0x00,     0x3C,     0x00,     0x00,     0x00,     0x00,     0xC0,     0x03,     0x00,     0x40,     0x07,     0x00,
-    0x00,     0xC0,     0x07,     0x00,     0x80,     0x0F,     0x00,     0x00,     0x00,     0x00,     0x80,     0x00,
-    0x00,     0x80,     0x03,     0x00,     0x00,     0x00,     0xFF,     0x07,     0xFF,     0x01,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x01,     0x00,     0x00,     0x00,     0xE0,     0xFF,
-    0x07,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0xE0,     0x07,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,     0x00,
-    0x00,     0x00,     0x00,     0x00 
-};
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 #define SPLASH_SCREEN_WIDTH 128
 #define SPLASH_SCREEN_HEIGHT 64
+#define SPLASH_SCREEN_BITMAP_SIZE 1024
+
+static const uint8_t SplashScreenPacked[] = {
+    0xBF, 0x00, 0x00, 0x60, 0x8C, 0x00, 0x00, 0x70, 0x85, 0x00, 0x01, 0xF0,
+    0x3F, 0x82, 0x00, 0x00, 0x70, 0x85, 0x00, 0x02, 0x3C, 0xE0, 0x01, 0x81,
+    0x00, 0x01, 0xF0, 0x03, 0x84, 0x00, 0x02, 0x07, 0x80, 0x03, 0x81, 0x00,
+    0x01, 0xF0, 0x1F, 0x83, 0x00, 0x03, 0x80, 0x01, 0x00, 0x06, 0x81, 0x00,
+    0x01, 0x70, 0xFC, 0x83, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0C, 0x81, 0x00,
+    0x02, 0x70, 0xC0, 0x07, 0x82, 0x00, 0x03, 0x60, 0x00, 0x00, 0x08, 0x81,
+    0x00, 0x02, 0x70, 0x00, 0x3F, 0x82, 0x00, 0x03, 0x20, 0x00, 0x00, 0x18,
+    0x81, 0x00, 0x03, 0x70, 0x00, 0xF0, 0x01, 0x81, 0x00, 0x03, 0x30, 0x80,
+    0x07, 0x10, 0x81, 0x00, 0x03, 0x70, 0x00, 0x80, 0x1F, 0x81, 0x00, 0x03,
+    0x10, 0x80, 0x07, 0x30, 0x81, 0x00, 0x03, 0x70, 0x00, 0x00, 0x3C, 0x81,
+    0x00, 0x03, 0x18, 0x40, 0x06, 0x30, 0x81, 0x00, 0x03, 0x70, 0x00, 0x00,
+    0x3E, 0x81, 0x00, 0x03, 0x1E, 0x40, 0x06, 0x78, 0x81, 0x00, 0x03, 0x70,
+    0x00, 0xC0, 0x1F, 0x80, 0x00, 0x05, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x01,
+    0x80, 0x00, 0x03, 0x70, 0x00, 0xF8, 0x01, 0x80, 0x00, 0x05, 0xE0, 0x0C,
+    0x00, 0x01, 0x00, 0x07, 0x80, 0x00, 0x02, 0x70, 0x00, 0x3E, 0x81, 0x00,
+    0x01, 0x30, 0x0C, 0x80, 0x00, 0x00, 0x04, 0x80, 0x00, 0x02, 0x70, 0xE0,
+    0x07, 0x81, 0x00, 0x05, 0x18, 0x04, 0x00, 0x0E, 0x00, 0x04, 0x80, 0x00,
+    0x01, 0x70, 0xFC, 0x82, 0x00, 0x05, 0x0C, 0x04, 0x00, 0x38, 0x00, 0x06,
+    0x80, 0x00, 0x01, 0xF0, 0x1F, 0x82, 0x00, 0x05, 0x0C, 0x04, 0x00, 0xF8,
+    0x83, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x03, 0x82, 0x00, 0x05, 0x06, 0x04,
+    0x00, 0x90, 0xFF, 0x01, 0x80, 0x00, 0x00, 0xF0, 0x83, 0x00, 0x04, 0x06,
+    0x04, 0x00, 0x30, 0x06, 0x81, 0x00, 0x00, 0x70, 0x83, 0x00, 0x04, 0x02,
+    0x07, 0x20, 0x40, 0x0E, 0x81, 0x00, 0x00, 0x70, 0x83, 0x00, 0x04, 0xF6,
+    0x07, 0x60, 0x80, 0x1F, 0x81, 0x00, 0x00, 0x70, 0x83, 0x00, 0x04, 0x3E,
+    0x04, 0xC0, 0x10, 0x10, 0x81, 0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0x0C,
+    0x80, 0x61, 0x18, 0x81, 0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0x0C, 0x00,
+    0xC3, 0x0F, 0x81, 0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0x8C, 0x00, 0x46,
+    0x06, 0x81, 0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0x88, 0x00, 0x6C, 0x04,
+    0x81, 0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0x18, 0x01, 0x38, 0x0C, 0x81,
+    0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0x18, 0x03, 0x30, 0x0C, 0x81, 0x00,
+    0x00, 0x70, 0x84, 0x00, 0x03, 0x18, 0x06, 0x20, 0x0C, 0x81, 0x00, 0x00,
+    0x70, 0x84, 0x00, 0x03, 0x30, 0x1C, 0x60, 0x0C, 0x81, 0x00, 0x00, 0x70,
+    0x84, 0x00, 0x03, 0x30, 0xF0, 0xE0, 0x07, 0x81, 0x00, 0x00, 0x70, 0x84,
+    0x00, 0x03, 0x20, 0xC0, 0xFF, 0x03, 0x81, 0x00, 0x00, 0x70, 0x84, 0x00,
+    0x02, 0x60, 0x00, 0xFC, 0x82, 0x00, 0x00, 0x70, 0x84, 0x00, 0x02, 0x40,
+    0x00, 0xC8, 0x82, 0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0xC0, 0x00, 0xCC,
+    0x01, 0x81, 0x00, 0x00, 0x70, 0x84, 0x00, 0x03, 0x80, 0x01, 0x84, 0x03,
+    0x81, 0x00, 0x00, 0x70, 0x85, 0x00, 0x02, 0x01, 0x04, 0x03, 0x81, 0x00,
+    0x00, 0x70, 0x85, 0x00, 0x02, 0x03, 0x04, 0x06, 0x81, 0x00, 0x00, 0x70,
+    0x85, 0x00, 0x02, 0x06, 0x04, 0x0C, 0x81, 0x00, 0x00, 0x70, 0x85, 0x00,
+    0x02, 0x04, 0x04, 0x0C, 0x81, 0x00, 0x00, 0x70, 0x85, 0x00, 0x09, 0x0C,
+    0x04, 0x18, 0xC0, 0x01, 0x00, 0x00, 0x70, 0xFE, 0x3F, 0x83, 0x00, 0x0A,
+    0x18, 0x1C, 0x30, 0xF0, 0x03, 0x00, 0x80, 0x77, 0x00, 0xF8, 0x03, 0x82,
+    0x00, 0x0A, 0x1E, 0x78, 0x70, 0x18, 0x03, 0x00, 0xF0, 0x71, 0x00, 0x00,
+    0x1F, 0x82, 0x00, 0x0A, 0x03, 0xC0, 0x61, 0x8C, 0x06, 0x00, 0x38, 0x70,
+    0x00, 0x00, 0x78, 0x81, 0x00, 0x0B, 0x80, 0x01, 0x00, 0xC3, 0x27, 0x06,
+    0x00, 0x0C, 0xFC, 0x03, 0x00, 0xE0, 0x81, 0x00, 0x0B, 0xC0, 0x00, 0x00,
+    0x82, 0x01, 0x06, 0x00, 0x06, 0xFF, 0x0F, 0x00, 0xC0, 0x81, 0x00, 0x0B,
+    0x40, 0x00, 0x01, 0x86, 0x03, 0x02, 0x00, 0x06, 0xFF, 0x0F, 0x00, 0x80,
+    0x81, 0x00, 0x0B, 0x60, 0x80, 0x03, 0x44, 0x04, 0x03, 0x00, 0x06, 0xFC,
+    0x03, 0x00, 0x80, 0x81, 0x00, 0x07, 0x60, 0xE0, 0x7C, 0x24, 0xF8, 0x01,
+    0x00, 0x0E, 0x80, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x07, 0x60, 0x7C, 0xE0,
+    0x27, 0x78, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x70, 0x81, 0x00, 0x07,
+    0x60, 0x0F, 0x00, 0x27, 0x08, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x3C,
+    0x81, 0x00, 0x0B, 0xC0, 0x03, 0x00, 0x40, 0x07, 0x00, 0x00, 0xC0, 0x07,
+    0x00, 0x80, 0x0F, 0x81, 0x00, 0x04, 0x80, 0x00, 0x00, 0x80, 0x03, 0x80,
+    0x00, 0x03, 0xFF, 0x07, 0xFF, 0x01, 0x85, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x02, 0xE0, 0xFF, 0x07, 0x85, 0x00, 0x01, 0xE0, 0x07, 0xBE, 0x00,
+};
+
+// Expands the packed splash into an XBM buffer of SPLASH_SCREEN_BITMAP_SIZE bytes.
+static inline bool splash_screen_decode(uint8_t *out, size_t out_size)
+{
+    if (!out || out_size < SPLASH_SCREEN_BITMAP_SIZE)
+    {
+        return false;
+    }
+
+    size_t written = 0;
+    size_t index = 0;
+    while (index < sizeof(SplashScreenPacked) && written < SPLASH_SCREEN_BITMAP_SIZE)
+    {
+        uint8_t control = SplashScreenPacked[index++];
+        if (control & 0x80)
+        {
+            size_t count = (size_t)(control & 0x7F) + 3;
+            if (index >= sizeof(SplashScreenPacked) || written + count > SPLASH_SCREEN_BITMAP_SIZE)
+            {
+                return false;
+            }
+            memset(out + written, SplashScreenPacked[index++], count);
+            written += count;
+        }
+        else
+        {
+            size_t count = (size_t)control + 1;
+            if (index + count > sizeof(SplashScreenPacked) || written + count > SPLASH_SCREEN_BITMAP_SIZE)
+            {
+                return false;
+            }
+            memcpy(out + written, &SplashScreenPacked[index], count);
+            index += count;
+            written += count;
+        }
+    }
+
+    return written == SPLASH_SCREEN_BITMAP_SIZE;
+}
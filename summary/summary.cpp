@@ -0,0 +1,214 @@
+#include "summary/summary.hpp"
+#include "app.hpp"
+#include "debug/trace.hpp"
+
+#include <cstdio>
+
+namespace
+{
+    void format_relative(char *out, size_t size, int value)
+    {
+        if (value == 0)
+        {
+            snprintf(out, size, "E");
+        }
+        else
+        {
+            snprintf(out, size, "%+d", value);
+        }
+    }
+}
+
+GolfScoreSummary::GolfScoreSummary(ViewDispatcher **viewDispatcher) : viewDispatcherRef(viewDispatcher)
+{
+}
+
+GolfScoreSummary::~GolfScoreSummary()
+{
+    if (view && viewDispatcherRef && *viewDispatcherRef)
+    {
+        view_dispatcher_remove_view(*viewDispatcherRef, GolfScoreViewSummary);
+        view_free(view);
+        view = nullptr;
+    }
+}
+
+uint32_t GolfScoreSummary::callbackToSubmenu(void *context)
+{
+    auto *summary = static_cast<GolfScoreSummary *>(context);
+    if (summary)
+    {
+        summary->active = false;
+    }
+    return GolfScoreViewSubmenu;
+}
+
+bool GolfScoreSummary::show(GolfScoreRoundSummary &&summary)
+{
+    if (!viewDispatcherRef || !*viewDispatcherRef)
+    {
+        return false;
+    }
+
+    if (!view)
+    {
+        if (!easy_flipper_set_view(&view, GolfScoreViewSummary, summaryDraw, summaryInput, callbackToSubmenu, viewDispatcherRef, this))
+        {
+            view = nullptr;
+            return false;
+        }
+        view_allocate_model(view, ViewModelTypeLocking, sizeof(Model));
+    }
+
+    auto *model = static_cast<Model *>(view_get_model(view));
+    current = std::move(summary);
+    model->summary = &current;
+    model->selected = 0;
+    model->top = 0;
+    view_commit_model(view, true);
+
+    active = true;
+    golf_score_switch_view(*viewDispatcherRef, GolfScoreViewSummary);
+    return true;
+}
+
+void GolfScoreSummary::summaryDraw(Canvas *canvas, void *model)
+{
+    auto *data = static_cast<Model *>(model);
+    if (!canvas || !data || !data->summary)
+    {
+        return;
+    }
+
+    const GolfScoreRoundSummary &summary = *data->summary;
+
+    canvas_clear(canvas);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_set_font_custom(canvas, FONT_SIZE_SMALL);
+
+    char line[40];
+    snprintf(line, sizeof(line), "%.12s  %u holes  Par %u", summary.course.data(), static_cast<unsigned>(summary.holeCount), static_cast<unsigned>(summary.coursePar));
+    canvas_draw_str(canvas, 2, 7, line);
+
+    canvas_set_font_custom(canvas, FONT_SIZE_MEDIUM);
+    for (uint8_t row = 0; row < VisibleRows && data->top + row < summary.playerCount; ++row)
+    {
+        uint8_t i = static_cast<uint8_t>(data->top + row);
+        const GolfScoreRoundResult &result = summary.results[i];
+        uint8_t y = static_cast<uint8_t>(18 + row * 10);
+        bool highlight = i == data->selected;
+
+        char relative[8];
+        format_relative(relative, sizeof(relative), result.relative);
+        snprintf(line, sizeof(line), "%u %-10.10s %3u %s", static_cast<unsigned>(result.rank), result.name.data(), static_cast<unsigned>(result.total), relative);
+
+        if (highlight)
+        {
+            canvas_draw_box(canvas, 0, y - 8, 128, 10);
+            canvas_set_color(canvas, ColorWhite);
+        }
+        canvas_draw_str(canvas, 2, y, line);
+        if (highlight)
+        {
+            canvas_set_color(canvas, ColorBlack);
+        }
+    }
+
+    if (summary.playerCount == 0 || !summary.results)
+    {
+        return;
+    }
+
+    const GolfScoreRoundResult &selected = summary.results[data->selected];
+    canvas_set_font_custom(canvas, FONT_SIZE_SMALL);
+
+    char best[16];
+    if (selected.bestHole < summary.holeCount)
+    {
+        char relative[8];
+        format_relative(relative, sizeof(relative), selected.bestRelative);
+        snprintf(best, sizeof(best), "Best H%u %s", static_cast<unsigned>(selected.bestHole + 1), relative);
+    }
+    else
+    {
+        snprintf(best, sizeof(best), "Best --");
+    }
+
+    char net[12] = "";
+    if (selected.handicap != 0)
+    {
+        char relative[8];
+        format_relative(relative, sizeof(relative), selected.netRelative);
+        snprintf(net, sizeof(net), " Net %s", relative);
+    }
+
+    if (summary.holeCount > 9 && net[0] != '\0')
+    {
+        // Single spaces so the net result still fits the line
+        snprintf(line, sizeof(line), "%s Out %u In %u%s", best, static_cast<unsigned>(selected.front), static_cast<unsigned>(selected.back), net);
+    }
+    else if (summary.holeCount > 9)
+    {
+        snprintf(line, sizeof(line), "%s  Out %u  In %u", best, static_cast<unsigned>(selected.front), static_cast<unsigned>(selected.back));
+    }
+    else
+    {
+        snprintf(line, sizeof(line), "%s  Out %u%s", best, static_cast<unsigned>(selected.front), net);
+    }
+    canvas_draw_str(canvas, 2, 63, line);
+
+    if (selected.putts > 0 || selected.penalties > 0 || selected.fairwaysTracked > 0 || selected.greens > 0)
+    {
+        snprintf(line, sizeof(line), "Putts %u  FW %u/%u  GIR %u  Pen %u",
+                 static_cast<unsigned>(selected.putts),
+                 static_cast<unsigned>(selected.fairwaysHit),
+                 static_cast<unsigned>(selected.fairwaysTracked),
+                 static_cast<unsigned>(selected.greens),
+                 static_cast<unsigned>(selected.penalties));
+        canvas_draw_str(canvas, 2, 56, line);
+    }
+}
+
+bool GolfScoreSummary::summaryInput(InputEvent *event, void *context)
+{
+    auto *summary = static_cast<GolfScoreSummary *>(context);
+    if (!summary || !event || !summary->view)
+    {
+        return false;
+    }
+
+    if (event->type != InputTypeShort && event->type != InputTypeRepeat)
+    {
+        return false;
+    }
+
+    if (event->key != InputKeyUp && event->key != InputKeyDown)
+    {
+        return false;
+    }
+
+    auto *model = static_cast<Model *>(view_get_model(summary->view));
+    uint8_t count = model->summary ? model->summary->playerCount : 0;
+    if (count > 0)
+    {
+        if (event->key == InputKeyUp)
+        {
+            model->selected = model->selected == 0 ? static_cast<uint8_t>(count - 1) : static_cast<uint8_t>(model->selected - 1);
+        }
+        else
+        {
+            model->selected = static_cast<uint8_t>((model->selected + 1) % count);
+        }
+
+        if (model->selected < model->top)
+        {
+            model->top = model->selected;
+        }
+        else if (model->selected >= model->top + VisibleRows)
+        {
+            model->top = static_cast<uint8_t>(model->selected - VisibleRows + 1);
+        }
+    }
+    view_commit_model(summary->view, true);
+    return true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "easy_flipper/easy_flipper.h"
+#include "golf_score_config.hpp"
+
+// One player's line on the round summary, filled in from the round
+// aggregates when the round is finished.
+struct GolfScoreRoundResult
+{
+    std::array<char, GolfScoreMaxNameLength> name{};
+    uint16_t total = 0;
+    int16_t relative = 0;
+    uint16_t front = 0;         // Strokes Out, the first half (all of a 9-hole round)
+    uint16_t back = 0;          // Strokes In, the second half
+    uint8_t rank = 0;           // 1-based, tied totals share a rank
+    uint8_t bestHole = 0xFF;    // 0-based, 0xFF when no hole was scored
+    int8_t bestRelative = 0;    // Strokes minus par on bestHole
+    int8_t handicap = 0;
+    int16_t netRelative = 0;    // Net strokes minus par of the holes played
+    uint16_t putts = 0;
+    uint16_t penalties = 0;
+    uint8_t fairwaysHit = 0;
+    uint8_t fairwaysTracked = 0; // Holes with a fairway result recorded
+    uint8_t greens = 0;          // Greens in regulation
+};
+
+struct GolfScoreRoundSummary
+{
+    std::array<char, GolfScoreCourseNameLength> course{};
+    uint8_t holeCount = 0;
+    uint16_t coursePar = 0;
+    uint8_t playerCount = 0;
+    std::unique_ptr<GolfScoreRoundResult[]> results; // playerCount entries, sorted by rank
+};
+
+class GolfScoreSummary
+{
+private:
+    static constexpr uint8_t VisibleRows = 4;
+
+    struct Model
+    {
+        const GolfScoreRoundSummary *summary;
+        uint8_t selected;
+        uint8_t top;
+    };
+
+    ViewDispatcher **viewDispatcherRef;
+    View *view = nullptr;
+    GolfScoreRoundSummary current;
+    bool active = false;
+
+    static uint32_t callbackToSubmenu(void *context);
+    static void summaryDraw(Canvas *canvas, void *model);
+    static bool summaryInput(InputEvent *event, void *context);
+
+public:
+    GolfScoreSummary(ViewDispatcher **viewDispatcher);
+    ~GolfScoreSummary();
+
+    bool show(GolfScoreRoundSummary &&summary);
+    bool isActive() const { return active; }
+};
@@ -0,0 +1,109 @@
+#include "teams/teams.hpp"
+
+#include <algorithm>
+
+GolfScoreTeamHole GolfScoreTeams::evaluate(const GolfScoreRound &round, uint8_t team, uint8_t hole, uint8_t player, uint8_t strokes) const
+{
+    GolfScoreTeamHole result;
+    for (uint8_t member = 0; member < round.playerCount(); ++member)
+    {
+        if (round.getTeam(member) != team)
+        {
+            continue;
+        }
+
+        uint8_t gross = member == player ? strokes : round.getStrokes(member, hole);
+        if (gross == 0)
+        {
+            continue;
+        }
+
+        int net = round.netStrokes(member, hole, gross);
+        if (mode == GolfScoreTeamsBestBall)
+        {
+            result.value = static_cast<int16_t>(result.scored == 0 ? net : std::min<int>(result.value, net));
+        }
+        else
+        {
+            result.value = static_cast<int16_t>(result.value + net);
+        }
+        ++result.scored;
+    }
+
+    if (result.scored > 0)
+    {
+        uint8_t par = round.getPar(hole);
+        result.par = static_cast<uint16_t>(mode == GolfScoreTeamsBestBall ? par : par * result.scored);
+    }
+    return result;
+}
+
+void GolfScoreTeams::add(uint8_t team, const GolfScoreTeamHole &hole, int sign)
+{
+    GolfScoreTeamTotal &total = totals[team];
+    total.total = static_cast<int16_t>(total.total + sign * hole.value);
+    total.parPlayed = static_cast<uint16_t>(total.parPlayed + sign * hole.par);
+}
+
+void GolfScoreTeams::reset(const GolfScoreRound &round, GolfScoreTeamMode teamMode)
+{
+    mode = teamMode;
+    teams = 0;
+    totals.fill(GolfScoreTeamTotal{});
+    if (mode == GolfScoreTeamsOff)
+    {
+        return;
+    }
+
+    for (uint8_t player = 0; player < round.playerCount(); ++player)
+    {
+        uint8_t team = round.getTeam(player);
+        if (team < GolfScoreMaxTeams)
+        {
+            ++totals[team].members;
+            teams = std::max<uint8_t>(teams, team + 1);
+        }
+    }
+
+    for (uint8_t team = 0; team < teams; ++team)
+    {
+        if (totals[team].members == 0)
+        {
+            continue;
+        }
+        for (uint8_t hole = 0; hole < round.holeCount(); ++hole)
+        {
+            add(team, evaluate(round, team, hole, NoPlayer, 0), 1);
+        }
+    }
+}
+
+void GolfScoreTeams::update(const GolfScoreRound &round, uint8_t player, uint8_t hole, uint8_t previous)
+{
+    uint8_t team = round.getTeam(player);
+    if (mode == GolfScoreTeamsOff || team >= teams)
+    {
+        return;
+    }
+
+    add(team, evaluate(round, team, hole, player, previous), -1);
+    add(team, evaluate(round, team, hole, NoPlayer, 0), 1);
+}
+
+uint8_t GolfScoreTeams::rank(uint8_t team) const
+{
+    uint8_t ahead = 0;
+    for (uint8_t other = 0; other < teams; ++other)
+    {
+        if (totals[other].members > 0 && relative(other) < relative(team))
+        {
+            ++ahead;
+        }
+    }
+    return static_cast<uint8_t>(ahead + 1);
+}
+
+GolfScoreTeamHole GolfScoreTeams::hole(const GolfScoreRound &round, uint8_t team, uint8_t holeIndex) const
+{
+    return evaluate(round, team, holeIndex, NoPlayer, 0);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "round/round.hpp"
+
+typedef enum
+{
+    GolfScoreTeamsOff = 0,
+    GolfScoreTeamsBestBall = 1,  // Team hole score is the best member's net
+    GolfScoreTeamsAggregate = 2, // Team hole score is the sum of the members' nets
+    GolfScoreTeamsModeCount = 3,
+} GolfScoreTeamMode;
+
+constexpr uint8_t GolfScoreNoTeam = 0xFF;
+constexpr size_t GolfScoreMaxTeams = GolfScoreMaxPlayers / 2;
+
+struct GolfScoreTeamTotal
+{
+    int16_t total = 0;      // Sum of the team's hole scores
+    uint16_t parPlayed = 0; // Par those hole scores are measured against
+    uint8_t members = 0;
+};
+
+// One team's score on one hole, from whichever members have played it.
+struct GolfScoreTeamHole
+{
+    int16_t value = 0;
+    uint8_t scored = 0; // Members with strokes on the hole
+    uint16_t par = 0;   // Par for value: the hole's par once for best ball, per scorer for aggregate
+};
+
+// Running team totals over the players' team assignments. A team's hole
+// score only depends on that hole's column, so a stroke change re-evaluates
+// one hole for one team: O(players), no per-hole state kept.
+class GolfScoreTeams
+{
+private:
+    static constexpr uint8_t NoPlayer = 0xFF;
+
+    GolfScoreTeamMode mode = GolfScoreTeamsOff;
+    uint8_t teams = 0; // Highest team id in use plus one
+    std::array<GolfScoreTeamTotal, GolfScoreMaxTeams> totals{};
+
+    // Evaluates the hole as if `player` had `strokes` on it (NoPlayer: as played)
+    GolfScoreTeamHole evaluate(const GolfScoreRound &round, uint8_t team, uint8_t hole, uint8_t player, uint8_t strokes) const;
+    void add(uint8_t team, const GolfScoreTeamHole &hole, int sign);
+
+public:
+    void reset(const GolfScoreRound &round, GolfScoreTeamMode teamMode);
+    // After player's strokes on hole changed from previous
+    void update(const GolfScoreRound &round, uint8_t player, uint8_t hole, uint8_t previous);
+
+    bool active() const { return mode != GolfScoreTeamsOff && teams > 0; }
+    uint8_t count() const { return teams; }
+    const GolfScoreTeamTotal &total(uint8_t team) const { return totals[team]; }
+    int16_t relative(uint8_t team) const { return static_cast<int16_t>(totals[team].total - totals[team].parPlayed); }
+    // 1-based by relative to par, ties share a rank; teams without members are skipped
+    uint8_t rank(uint8_t team) const;
+    GolfScoreTeamHole hole(const GolfScoreRound &round, uint8_t team, uint8_t holeIndex) const;
+
+    static char letter(uint8_t team) { return static_cast<char>('A' + team); }
+};
@@ -34,6 +34,10 @@ typedef struct
     void *validator_callback_context;
     FuriString *validator_text;
     bool valadator_message_visible;
+
+    UART_TextInputCallback changed_callback;
+    void *changed_callback_context;
+    bool text_changed;
 } UART_TextInputModel;
 
 static const uint8_t keyboard_origin_x = 1;
@@ -45,6 +49,21 @@ static const uint8_t keyboard_row_count = 4;
 #define ENTER_KEY '\r'
 #define BACKSPACE_KEY '\b'
 
+#define GLYPH_CACHE_FIRST 0x20
+#define GLYPH_CACHE_COUNT 0x5F
+
+// Per-font printable ASCII metrics: the advance to the next glyph, and the
+// width of the glyph when it ends the string (what canvas_string_width adds
+// for the last character instead of its advance).
+typedef struct
+{
+    bool ready;
+    uint8_t advance[GLYPH_CACHE_COUNT];
+    uint8_t tail[GLYPH_CACHE_COUNT];
+} UART_TextInputGlyphMetrics;
+
+static UART_TextInputGlyphMetrics glyph_metrics_cache[FontTotalNumber];
+
 static const UART_TextInputKey keyboard_keys_row_1[] = {
     {'{', 1, 0},
     {'(', 9, 0},
@@ -296,46 +315,113 @@ static void uart_text_input_backspace_cb(UART_TextInputModel *model)
     if (text_length > 0)
     {
         model->text_buffer[text_length - 1] = 0;
+        model->text_changed = true;
+    }
+}
+
+static const UART_TextInputGlyphMetrics *glyph_metrics_get(Canvas *canvas, Font font)
+{
+    UART_TextInputGlyphMetrics *metrics = &glyph_metrics_cache[font];
+    if (!metrics->ready)
+    {
+        char glyph[2] = {0, 0};
+        for (uint8_t index = 0; index < GLYPH_CACHE_COUNT; index++)
+        {
+            glyph[0] = (char)(GLYPH_CACHE_FIRST + index);
+            metrics->advance[index] = (uint8_t)canvas_glyph_width(canvas, (uint16_t)glyph[0]);
+            metrics->tail[index] = (uint8_t)canvas_string_width(canvas, glyph);
+        }
+        metrics->ready = true;
     }
+    return metrics;
+}
+
+static uint16_t glyph_advance(Canvas *canvas, const UART_TextInputGlyphMetrics *metrics, char symbol)
+{
+    uint8_t code = (uint8_t)symbol;
+    if (code >= GLYPH_CACHE_FIRST && code < GLYPH_CACHE_FIRST + GLYPH_CACHE_COUNT)
+    {
+        return metrics->advance[code - GLYPH_CACHE_FIRST];
+    }
+    return canvas_glyph_width(canvas, code);
+}
+
+static uint16_t glyph_tail(Canvas *canvas, const UART_TextInputGlyphMetrics *metrics, char symbol)
+{
+    uint8_t code = (uint8_t)symbol;
+    if (code >= GLYPH_CACHE_FIRST && code < GLYPH_CACHE_FIRST + GLYPH_CACHE_COUNT)
+    {
+        return metrics->tail[code - GLYPH_CACHE_FIRST];
+    }
+    char glyph[2] = {symbol, 0};
+    return canvas_string_width(canvas, glyph);
 }
 
 static void uart_text_input_view_draw_callback(Canvas *canvas, void *_model)
 {
     UART_TextInputModel *model = _model;
-    // uint8_t text_length = model->text_buffer ? strlen(model->text_buffer) : 0;
     uint8_t needed_string_width = canvas_width(canvas) - 8;
     uint8_t start_pos = 4;
 
     const char *text = model->text_buffer;
+    size_t text_length = text ? strlen(text) : 0;
 
     canvas_clear(canvas);
     canvas_set_color(canvas, ColorBlack);
+    canvas_set_font(canvas, FontSecondary);
+    const UART_TextInputGlyphMetrics *metrics = glyph_metrics_get(canvas, FontSecondary);
 
     canvas_draw_str(canvas, 2, 7, model->header);
     elements_slightly_rounded_frame(canvas, 1, 8, 126, 12);
 
-    if (canvas_string_width(canvas, text) > needed_string_width)
+    // Grow the visible suffix backwards from the last character; its width is
+    // the advances of every glyph but the last, plus the last glyph's tail.
+    size_t visible_start = text_length;
+    uint16_t visible_width = 0;
+    if (text_length > 0)
+    {
+        visible_start = text_length - 1;
+        visible_width = glyph_tail(canvas, metrics, text[visible_start]);
+        while (visible_start > 0)
+        {
+            uint16_t advance = glyph_advance(canvas, metrics, text[visible_start - 1]);
+            if (visible_width + advance > needed_string_width)
+            {
+                break;
+            }
+            visible_width += advance;
+            visible_start--;
+        }
+    }
+
+    if (visible_start > 0)
     {
         canvas_draw_str(canvas, start_pos, 17, "...");
         start_pos += 6;
         needed_string_width -= 8;
+
+        while (visible_start + 1 < text_length && visible_width > needed_string_width)
+        {
+            visible_width -= glyph_advance(canvas, metrics, text[visible_start]);
+            visible_start++;
+        }
     }
 
-    while (text != 0 && canvas_string_width(canvas, text) > needed_string_width)
+    if (text)
     {
-        text++;
+        text += visible_start;
     }
 
     if (model->clear_default_text)
     {
         elements_slightly_rounded_box(
-            canvas, start_pos - 1, 14, canvas_string_width(canvas, text) + 2, 10);
+            canvas, start_pos - 1, 14, visible_width + 2, 10);
         canvas_set_color(canvas, ColorWhite);
     }
     else
     {
-        canvas_draw_str(canvas, start_pos + canvas_string_width(canvas, text) + 1, 18, "|");
-        canvas_draw_str(canvas, start_pos + canvas_string_width(canvas, text) + 2, 18, "|");
+        canvas_draw_str(canvas, start_pos + visible_width + 1, 18, "|");
+        canvas_draw_str(canvas, start_pos + visible_width + 2, 18, "|");
     }
     canvas_draw_str(canvas, start_pos, 17, text);
 
@@ -528,6 +614,7 @@ static void uart_text_input_handle_ok(
         {
             model->text_buffer[text_length] = selected;
             model->text_buffer[text_length + 1] = 0;
+            model->text_changed = true;
         }
     }
     model->clear_default_text = false;
@@ -628,9 +715,19 @@ static bool uart_text_input_view_input_callback(InputEvent *event, void *context
         }
     }
 
+    // Report edits after the model is released so the callback may update the view
+    UART_TextInputCallback changed_callback = model->text_changed ? model->changed_callback : NULL;
+    void *changed_callback_context = model->changed_callback_context;
+    model->text_changed = false;
+
     // Commit model
     view_commit_model(uart_text_input->view, consumed);
 
+    if (changed_callback)
+    {
+        changed_callback(changed_callback_context);
+    }
+
     return consumed;
 }
 
@@ -708,6 +805,9 @@ void uart_text_input_reset(UART_TextInput *uart_text_input)
             model->validator_callback_context = NULL;
             furi_string_reset(model->validator_text);
             model->valadator_message_visible = false;
+            model->changed_callback = NULL;
+            model->changed_callback_context = NULL;
+            model->text_changed = false;
         },
         true);
 }
@@ -760,6 +860,21 @@ void uart_text_input_set_validator(
         true);
 }
 
+void uart_text_input_set_changed_callback(
+    UART_TextInput *uart_text_input,
+    UART_TextInputCallback callback,
+    void *callback_context)
+{
+    with_view_model(
+        uart_text_input->view,
+        UART_TextInputModel * model,
+        {
+            model->changed_callback = callback;
+            model->changed_callback_context = callback_context;
+        },
+        false);
+}
+
 UART_TextInputValidatorCallback
 uart_text_input_get_validator_callback(UART_TextInput *uart_text_input)
 {
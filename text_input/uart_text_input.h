@@ -66,6 +66,17 @@ extern "C"
         UART_TextInputValidatorCallback callback,
         void *callback_context);
 
+    /** Set a callback run after every edit of the text buffer
+     *
+     * @param      uart_text_input     UART_TextInput instance
+     * @param      callback            callback fn, called outside the model lock
+     * @param      callback_context    callback context
+     */
+    void uart_text_input_set_changed_callback(
+        UART_TextInput *uart_text_input,
+        UART_TextInputCallback callback,
+        void *callback_context);
+
     UART_TextInputValidatorCallback
     uart_text_input_get_validator_callback(UART_TextInput *uart_text_input);
 
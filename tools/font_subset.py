@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+"""Subset the embedded u8g2 fonts down to the glyphs the app can draw.
+
+Reads the full tables from font/font_source.h, scans the app sources for the
+characters that can reach the canvas, and writes font/font_subset.h, which is
+what font/font.c compiles in.
+
+The character set is the union of:
+  * every string and character literal in the app sources,
+  * the output alphabet of each printf conversion in those literals
+    (%u -> digits, %d -> digits and '-', %x -> hex digits, ...),
+  * for %s/%c, the user-enterable alphabet, taken from the on-screen
+    keyboard in text_input/uart_text_input.c (plus shifted letters).
+
+Fonts whose FONT_SIZE_* is never referenced outside font/ are emitted empty.
+
+Usage:
+  python3 tools/font_subset.py          regenerate font/font_subset.h
+  python3 tools/font_subset.py --check  exit 1 if font/font_subset.h is stale
+
+Any other argument prints this usage and exits 2 without writing anything.
+"""
+
+import os
+import re
+import sys
+
+HEADER_SIZE = 23
+SOURCE_EXTENSIONS = (".c", ".cpp", ".h", ".hpp")
+EXCLUDED_DIRS = {"font", "jsmn", "tools", "assets", "screenshots", "host", ".git", ".idea", ".vscode"}
+KEYBOARD_SOURCE = os.path.join("text_input", "uart_text_input.c")
+
+FONT_ARRAY_PATTERN = re.compile(r"(/\*(?:(?!\*/).)*\*/)\s*static const uint8_t (\w+)\[\] =\s*((?:\"(?:[^\"\\]|\\.)*\"\s*)+);", re.S)
+FONT_CASE_PATTERN = re.compile(r"case (FONT_SIZE_\w+):\s*canvas_set_custom_u8g2_font\(canvas, (\w+)\)")
+FORMAT_PATTERN = re.compile(r"%[-+ #0]*(?:\*|\d+)?(?:\.(?:\*|\d+))?(?:hh|h|ll|l|z|j|t|L)?([diouxXcsp%])")
+KEY_PATTERN = re.compile(r"\{'((?:[^'\\]|\\.))',\s*\d+,\s*\d+\}")
+
+ESCAPES = {"n": 10, "r": 13, "t": 9, "b": 8, "a": 7, "f": 12, "v": 11, "\\": 92, "'": 39, '"': 34, "?": 63}
+
+
+def decode_c_string(body):
+    out = bytearray()
+    index = 0
+    while index < len(body):
+        ch = body[index]
+        if ch != "\\":
+            out.append(ord(ch))
+            index += 1
+            continue
+        index += 1
+        ch = body[index]
+        if ch in "01234567":
+            end = index
+            while end < len(body) and end < index + 3 and body[end] in "01234567":
+                end += 1
+            out.append(int(body[index:end], 8) & 0xFF)
+            index = end
+        elif ch == "x":
+            end = index + 1
+            while end < len(body) and body[end] in "0123456789abcdefABCDEF":
+                end += 1
+            out.append(int(body[index + 1 : end], 16) & 0xFF)
+            index = end
+        else:
+            out.append(ESCAPES.get(ch, ord(ch)))
+            index += 1
+    return bytes(out)
+
+
+def tokenize_literals(text):
+    """Yields (kind, body) for each string/char literal, skipping comments and includes."""
+    index = 0
+    length = len(text)
+    line_start = True
+    while index < length:
+        ch = text[index]
+        if line_start and ch == "#":
+            end = text.find("\n", index)
+            directive = text[index : end if end >= 0 else length]
+            if re.match(r"#\s*include", directive):
+                index = end if end >= 0 else length
+                continue
+        if ch == "\n":
+            line_start = True
+            index += 1
+            continue
+        if not ch.isspace():
+            line_start = False
+        if text.startswith("//", index):
+            end = text.find("\n", index)
+            index = end if end >= 0 else length
+        elif text.startswith("/*", index):
+            end = text.find("*/", index + 2)
+            index = end + 2 if end >= 0 else length
+        elif ch in "\"'":
+            end = index + 1
+            while end < length and text[end] != ch:
+                end += 2 if text[end] == "\\" else 1
+            yield ch, text[index + 1 : end]
+            index = end + 1
+        else:
+            index += 1
+
+
+def source_files(root):
+    for directory, dirs, files in os.walk(root):
+        dirs[:] = sorted(d for d in dirs if d not in EXCLUDED_DIRS and not d.startswith("_"))
+        for name in sorted(files):
+            if name.endswith(SOURCE_EXTENSIONS):
+                yield os.path.join(directory, name)
+
+
+def keyboard_alphabet(root):
+    with open(os.path.join(root, KEYBOARD_SOURCE), "r", encoding="utf-8") as handle:
+        text = handle.read()
+    chars = set(b" ")
+    for match in KEY_PATTERN.finditer(text):
+        value = decode_c_string(match.group(1))
+        chars.update(value)
+        chars.update(value.upper())
+    return chars
+
+
+def conversion_alphabet(conversion, text_chars):
+    if conversion in "diu":
+        return set(b"-0123456789")
+    if conversion == "o":
+        return set(b"01234567")
+    if conversion in "xp":
+        return set(b"0123456789abcdefx")
+    if conversion == "X":
+        return set(b"0123456789ABCDEFX")
+    if conversion == "%":
+        return set(b"%")
+    return set(text_chars)
+
+
+def collect_characters(root):
+    text_chars = keyboard_alphabet(root)
+    chars = set(b" ")
+    sizes = set()
+    for path in source_files(root):
+        with open(path, "r", encoding="utf-8", errors="replace") as handle:
+            text = handle.read()
+        sizes.update(re.findall(r"\bFONT_SIZE_\w+", text))
+        for kind, body in tokenize_literals(text):
+            value = decode_c_string(body)
+            if kind == '"':
+                for match in FORMAT_PATTERN.finditer(value.decode("latin-1")):
+                    chars.update(conversion_alphabet(match.group(1), text_chars))
+                value = FORMAT_PATTERN.sub("", value.decode("latin-1")).encode("latin-1")
+            chars.update(value)
+    return {ch for ch in chars if ch >= 0x20}, sizes
+
+
+def parse_fonts(root):
+    with open(os.path.join(root, "font", "font_source.h"), "r", encoding="latin-1") as handle:
+        source = handle.read()
+    fonts = []
+    for match in FONT_ARRAY_PATTERN.finditer(source):
+        literal = "".join(re.findall(r"\"((?:[^\"\\]|\\.)*)\"", match.group(3)))
+        fonts.append((match.group(1), match.group(2), decode_c_string(literal)))
+
+    with open(os.path.join(root, "font", "font.c"), "r", encoding="latin-1") as handle:
+        mapping = {name: size for size, name in FONT_CASE_PATTERN.findall(handle.read())}
+    return fonts, mapping
+
+
+def subset_font(data, keep):
+    start_upper = (data[17] << 8) | data[18]
+    start_lower = (data[19] << 8) | data[20]
+    start_unicode = (data[21] << 8) | data[22]
+    del start_upper, start_lower
+
+    glyphs = []
+    offset = HEADER_SIZE
+    while data[offset + 1] != 0:
+        jump = data[offset + 1]
+        glyphs.append((data[offset], data[offset : offset + jump]))
+        offset += jump
+    if offset != HEADER_SIZE + start_unicode - 2:
+        raise ValueError("unexpected u8g2 layout: ASCII table ends at %d" % offset)
+    tail = data[offset:]
+
+    body = bytearray()
+    upper = None
+    lower = None
+    kept = 0
+    for encoding, glyph in glyphs:
+        if encoding not in keep:
+            continue
+        if upper is None and encoding >= ord("A"):
+            upper = len(body)
+        if lower is None and encoding >= ord("a"):
+            lower = len(body)
+        body.extend(glyph)
+        kept += 1
+    upper = len(body) if upper is None else upper
+    lower = len(body) if lower is None else lower
+    unicode_start = len(body) + 2
+
+    header = bytearray(data[:HEADER_SIZE])
+    header[0] = kept
+    header[17:19] = upper.to_bytes(2, "big")
+    header[19:21] = lower.to_bytes(2, "big")
+    header[21:23] = unicode_start.to_bytes(2, "big")
+    return bytes(header + body + tail), kept, len(glyphs)
+
+
+def c_literal(data, width=76):
+    lines = []
+    line = ""
+    previous_octal = False
+    for value in data:
+        ch = chr(value)
+        if 0x20 <= value < 0x7F and ch not in "\"\\?" and not (previous_octal and ch in "01234567"):
+            token = ch
+            previous_octal = False
+        else:
+            token = "\\%o" % value
+            previous_octal = True
+        if len(line) + len(token) > width:
+            lines.append(line)
+            line = ""
+        line += token
+    lines.append(line)
+    return "\n".join('    "%s"' % item for item in lines)
+
+
+def render(fonts, mapping, chars, sizes):
+    blocks = []
+    report = []
+    for comment, name, data in fonts:
+        size = mapping.get(name)
+        keep = chars if size in sizes else set()
+        # The literal's terminating NUL is implied by the string, so strip the decoded copy of it.
+        subset, kept, total = subset_font(data[:-1] if data.endswith(b"\0") else data, keep)
+        before = len(data) + (0 if data.endswith(b"\0") else 1)
+        after = len(subset) + 1
+        report.append((name, size, total, kept, before, after))
+        note = "  Subset: %d/%d glyphs%s\n*/" % (kept, total, "" if size in sizes else " (%s unused)" % size)
+        blocks.append("%s\nstatic const uint8_t %s[] =\n%s;\n" % (comment[:-2].rstrip() + "\n" + note, name, c_literal(subset)))
+
+    charset = "".join(chr(ch) for ch in sorted(chars) if ch < 0x7F)
+    text = """#pragma once
+
+// Generated by tools/font_subset.py from font/font_source.h - do not edit by hand.
+// Character set: %s
+
+#include <stdint.h>
+
+%s""" % (charset.replace("*/", "* /"), "\n".join(blocks))
+    return text, report
+
+
+def main(argv):
+    args = argv[1:]
+    if args not in ([], ["--check"]):
+        print("usage: %s [--check]" % os.path.basename(argv[0]), file=sys.stderr)
+        return 2
+    check = bool(args)
+
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    target = os.path.join(root, "font", "font_subset.h")
+
+    fonts, mapping = parse_fonts(root)
+    chars, sizes = collect_characters(root)
+    text, report = render(fonts, mapping, chars, sizes)
+
+    saved = 0
+    for name, size, total, kept, before, after in report:
+        saved += before - after
+        print("%-18s %-16s %3d/%3d glyphs %5d -> %5d bytes" % (name, size, kept, total, before, after))
+    print("flash saved: %d bytes" % saved)
+
+    if check:
+        with open(target, "r", encoding="latin-1") as handle:
+            if handle.read() != text:
+                print("font/font_subset.h is stale; run tools/font_subset.py", file=sys.stderr)
+                return 1
+        return 0
+
+    with open(target, "w", encoding="latin-1") as handle:
+        handle.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Compress assets/splash.xbm into splash_screen.h.
+
+The bitmap is stored as a byte-oriented run-length stream that
+splash_screen_decode() in splash_screen.h expands once at start-up:
+
+    0x00..0x7F  literal: the next (control + 1) bytes are copied as-is
+    0x80..0xFF  run:     the next byte is repeated ((control & 0x7F) + 3) times
+
+Usage: python3 tools/splash_rle.py [assets/splash.xbm] [splash_screen.h]
+"""
+
+import os
+import re
+import sys
+
+MIN_RUN = 3
+MAX_RUN = 0x7F + MIN_RUN
+MAX_LITERAL = 0x80
+
+
+def read_xbm(path):
+    with open(path, "r", encoding="ascii") as handle:
+        text = handle.read()
+    width = int(re.search(r"_width\s+(\d+)", text).group(1))
+    height = int(re.search(r"_height\s+(\d+)", text).group(1))
+    body = text[text.index("{") + 1 : text.rindex("}")]
+    data = bytes(int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body))
+    if len(data) != ((width + 7) // 8) * height:
+        raise ValueError("%s: expected %d bytes, found %d" % (path, ((width + 7) // 8) * height, len(data)))
+    return width, height, data
+
+
+def encode(data):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[: len(chunk)]
+
+    index = 0
+    while index < len(data):
+        run = 1
+        while index + run < len(data) and data[index + run] == data[index] and run < MAX_RUN:
+            run += 1
+        if run >= MIN_RUN:
+            flush_literal()
+            out.append(0x80 | (run - MIN_RUN))
+            out.append(data[index])
+            index += run
+        else:
+            literal.append(data[index])
+            index += 1
+    flush_literal()
+    return bytes(out)
+
+
+def decode(stream, size):
+    out = bytearray()
+    index = 0
+    while index < len(stream) and len(out) < size:
+        control = stream[index]
+        index += 1
+        if control & 0x80:
+            out.extend(bytes([stream[index]]) * ((control & 0x7F) + MIN_RUN))
+            index += 1
+        else:
+            out.extend(stream[index : index + control + 1])
+            index += control + 1
+    return bytes(out[:size])
+
+
+def render_header(width, height, raw, packed):
+    lines = []
+    for offset in range(0, len(packed), 12):
+        lines.append("    " + ", ".join("0x%02X" % value for value in packed[offset : offset + 12]) + ",")
+    return """#pragma once
+
+// Generated by tools/splash_rle.py from assets/splash.xbm - do not edit by hand.
+// %d bytes raw, %d bytes packed.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SPLASH_SCREEN_WIDTH %d
+#define SPLASH_SCREEN_HEIGHT %d
+#define SPLASH_SCREEN_BITMAP_SIZE %d
+
+static const uint8_t SplashScreenPacked[] = {
+%s
+};
+
+// Expands the packed splash into an XBM buffer of SPLASH_SCREEN_BITMAP_SIZE bytes.
+static inline bool splash_screen_decode(uint8_t *out, size_t out_size)
+{
+    if (!out || out_size < SPLASH_SCREEN_BITMAP_SIZE)
+    {
+        return false;
+    }
+
+    size_t written = 0;
+    size_t index = 0;
+    while (index < sizeof(SplashScreenPacked) && written < SPLASH_SCREEN_BITMAP_SIZE)
+    {
+        uint8_t control = SplashScreenPacked[index++];
+        if (control & 0x80)
+        {
+            size_t count = (size_t)(control & 0x7F) + %d;
+            if (index >= sizeof(SplashScreenPacked) || written + count > SPLASH_SCREEN_BITMAP_SIZE)
+            {
+                return false;
+            }
+            memset(out + written, SplashScreenPacked[index++], count);
+            written += count;
+        }
+        else
+        {
+            size_t count = (size_t)control + 1;
+            if (index + count > sizeof(SplashScreenPacked) || written + count > SPLASH_SCREEN_BITMAP_SIZE)
+            {
+                return false;
+            }
+            memcpy(out + written, &SplashScreenPacked[index], count);
+            index += count;
+            written += count;
+        }
+    }
+
+    return written == SPLASH_SCREEN_BITMAP_SIZE;
+}
+""" % (len(raw), len(packed), width, height, len(raw), "\n".join(lines), MIN_RUN)
+
+
+def main(argv):
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    source = argv[1] if len(argv) > 1 else os.path.join(root, "assets", "splash.xbm")
+    target = argv[2] if len(argv) > 2 else os.path.join(root, "splash_screen.h")
+
+    width, height, raw = read_xbm(source)
+    packed = encode(raw)
+    if decode(packed, len(raw)) != raw:
+        raise RuntimeError("round-trip check failed")
+
+    with open(target, "w", encoding="ascii") as handle:
+        handle.write(render_header(width, height, raw, packed))
+
+    print("%s: %d -> %d bytes (%.1f%%)" % (os.path.basename(target), len(raw), len(packed), 100.0 * len(packed) / len(raw)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
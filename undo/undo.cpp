@@ -0,0 +1,43 @@
+#include "undo/undo.hpp"
+
+void GolfScoreUndoRing::clear()
+{
+    head = 0;
+    count = 0;
+    cursor = 0;
+}
+
+void GolfScoreUndoRing::push(const GolfScoreEditOp &op)
+{
+    count = cursor;
+    if (count == GolfScoreUndoDepth)
+    {
+        head = static_cast<uint8_t>((head + 1) % GolfScoreUndoDepth);
+        --count;
+    }
+    slot(count) = op;
+    ++count;
+    cursor = count;
+}
+
+bool GolfScoreUndoRing::undo(GolfScoreEditOp &op)
+{
+    if (cursor == 0)
+    {
+        return false;
+    }
+    --cursor;
+    op = slot(cursor);
+    return true;
+}
+
+bool GolfScoreUndoRing::redo(GolfScoreEditOp &op)
+{
+    if (cursor == count)
+    {
+        return false;
+    }
+    op = slot(cursor);
+    ++cursor;
+    return true;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "golf_score_config.hpp"
+#include "round/round.hpp"
+
+// One hole edit: the entry before and after it, enough to step either way
+// without a snapshot of the card.
+struct GolfScoreEditOp
+{
+    uint8_t player = 0;
+    uint8_t hole = 0;
+    GolfScoreHoleEntry before{};
+    GolfScoreHoleEntry after{};
+};
+static_assert(sizeof(GolfScoreEditOp) == 6, "edit op layout changed");
+
+// Fixed ring of the latest hole edits. Ops before the cursor can be undone,
+// ops after it redone; a new edit drops the redo side, and past
+// GolfScoreUndoDepth edits the oldest falls off.
+class GolfScoreUndoRing
+{
+private:
+    std::array<GolfScoreEditOp, GolfScoreUndoDepth> ops{};
+    uint8_t head = 0;   // Slot of the oldest op
+    uint8_t count = 0;  // Ops held
+    uint8_t cursor = 0; // Ops currently applied
+
+    GolfScoreEditOp &slot(uint8_t index) { return ops[(head + index) % GolfScoreUndoDepth]; }
+
+public:
+    void clear();
+    void push(const GolfScoreEditOp &op);
+    // Steps the cursor and hands back the op to revert or reapply
+    bool undo(GolfScoreEditOp &op);
+    bool redo(GolfScoreEditOp &op);
+
+    bool canUndo() const { return cursor > 0; }
+    bool canRedo() const { return cursor < count; }
+    uint8_t size() const { return count; }
+    uint8_t applied() const { return cursor; }
+    // Oldest first
+    const GolfScoreEditOp &at(uint8_t index) const { return ops[(head + index) % GolfScoreUndoDepth]; }
+};